@@ -10,12 +10,13 @@ uniform float flicker_speed;
 uniform float flicker_intensity;
 uniform float color_offset;
 uniform float time;
-uniform vec2 texture_size; // size of the input texture
+uniform vec2 texture_size; // size of the input in pixels
+uniform vec2 uv_scale; // part of the texture the input covers
 
 void main()
 {
     vec2 uv = gl_TexCoord[0].xy;
-    vec2 pixel_size = 1.0 / texture_size;
+    vec2 pixel_size = uv_scale / texture_size;
     float offset = color_offset * pixel_size.x;
 
     // Chromatic aberration
@@ -25,7 +26,7 @@ void main()
     vec4 aberrate = vec4(channel_r, channel_g, channel_b, 1.0);
 
     // Flicker effect
-    float mix_value = sin((uv.y - (time * flicker_speed)) * 10.0) * flicker_intensity;
+    float mix_value = sin((uv.y / uv_scale.y - (time * flicker_speed)) * 10.0) * flicker_intensity;
     vec4 flicker = mix(aberrate, flicker_color, mix_value);
 
     // Scanlines
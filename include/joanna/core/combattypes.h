@@ -1,6 +1,8 @@
 #pragma once
 
-#include "joanna/entities/entityutils.h"
+#include "joanna/entities/entitystate.h"
+#include <array>
+#include <cstdint>
 #include <string>
 
 #define COMBAT_TRIGGERED 1
@@ -8,10 +10,26 @@
 
 enum class CombatState { PlayerTurn, EnemyTurn, Victory, Defeat };
 
+enum class EnemyType { Goblin, Skeleton };
+
+// Points on an attack's timeline, in the order they fire at equal times
+enum class AttackEvent : std::uint8_t {
+    CounterOpen,
+    Impact,
+    CounterClose,
+    End
+};
+
+struct AttackKey {
+    float time = 0.f;
+    AttackEvent event = AttackEvent::End;
+};
+
+// Loaded from assets/combat/attacks.json, see AttackTable
 struct Attack {
-    std::string name;       // name of the attack for debugging
-    int damage;             // damage dealt to the target
-    State animationState;   // animation state to play
+    std::string name;                     // name of the attack for debugging
+    int damage = 0;                       // damage dealt to the target
+    State animationState = State::Attack; // animation state to play
 
     // timing
     float impactTime = 0.5f; // time when the attack hits/deals damage
@@ -28,4 +46,8 @@ struct Attack {
     float counterWindowEnd = 0.f;   // end time of the counter window
 
     float approachOffset = 0.f; // offset for the initial approach position
+
+    // the times above as keys sorted by time, played by an AttackCursor
+    std::array<AttackKey, 4> timeline{};
+    std::uint8_t timelineSize = 0;
 };
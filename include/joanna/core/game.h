@@ -2,24 +2,30 @@
 
 #include "joanna/core/postprocessing.h"
 #include "joanna/core/renderengine.h"
+#include "joanna/core/saveworker.h"
 #include "joanna/core/windowmanager.h"
 #include "joanna/entities/enemy.h"
 #include "joanna/game/combat/combat_system.h"
+#include "joanna/systems/aischeduler.h"
 #include "joanna/systems/audiomanager.h"
 #include "joanna/systems/controller.h"
 #include "joanna/systems/font_renderer.h"
 #include "joanna/systems/gameover.h"
+#include "joanna/systems/hud.h"
+#include "joanna/systems/inputrecorder.h"
 #include "joanna/systems/menu.h"
 #include "joanna/utils/dialogue_box.h"
+#include "joanna/world/region.h"
 #include "joanna/world/tilemanager.h"
 
 #include <SFML/System/Vector2.hpp>
 #include <list>
 #include <memory>
+#include <optional>
 
 class Game {
   public:
-    Game();
+    explicit Game(InputRecorder& inputRecorder);
     void run();
     void resetEntities();
 
@@ -27,15 +33,33 @@ class Game {
         enemyPtr = nullptr;
     }
 
+    SaveWorker& getSaveWorker() {
+        return saveWorker;
+    }
+
+    PostProcessing& getPostProcessing() {
+        return postProc;
+    }
+
+    double getPlayTime() const {
+        return playTime;
+    }
+
+    void setPlayTime(double seconds) {
+        playTime = seconds;
+    }
+
   private:
     void initialize();
     void handleInput();
+    bool pollInput(float dt);
     void update(float dt);
     void render(float dt);
 
     void updateOverworld(float dt);
     void updateCombat(float dt);
     void updateGameOver(float dt);
+    int updateEnemy(Enemy& enemy, float dt);
     void renderOverworld(float dt);
     void renderCombat();
     void renderGameOver();
@@ -53,6 +77,9 @@ class Game {
     CombatSystem combatSystem;
     PostProcessing postProc;
     FontRenderer fontRenderer;
+    Hud hud;
+    AIScheduler aiScheduler;
+    SaveWorker saveWorker;
 
     // Game State
     std::unique_ptr<Controller>
@@ -62,11 +89,18 @@ class Game {
     std::unique_ptr<Menu> menu; // our menu needs references, so ptr
     std::unique_ptr<GameOver> gameOverScreen;
 
+    // Input of the current tick, either sampled live or read from a replay
+    InputRecorder& inputRecorder;
+    InputSnapshot currentInput;
+    InputSnapshot pendingPresses; // key-press edges collected from events
+
     void returnToMenu();
 
     MusicId currentMusicId = MusicId::Overworld;
     GameStatus gameStatus = GameStatus::Overworld;
     sf::Clock clock;
+    double playTime = 0.0; // seconds, stored with the save
+    std::optional<Region> lastRegion; // autosaves when the player leaves it
 
     std::list<std::unique_ptr<Entity>> entities;
     std::shared_ptr<DialogueBox> sharedDialogueBox;
@@ -4,30 +4,157 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
 
+/**
+ * Ordered chain of full-screen shader passes. The scene is drawn into one of
+ * two ping-pong render textures; each enabled pass reads the previous output
+ * and writes the other texture (at its own resolution scale), the last one
+ * writes the window. With every pass disabled the scene is drawn straight
+ * into the window and the render textures are released.
+ *
+ * Passes are configured in assets/shader/effects.json. Uniform values are
+ * cached per pass and only uploaded when they change.
+ *
+ * The scene may be rendered below window resolution, as a fraction of the
+ * window or at a virtual height upscaled by a whole factor, and is then
+ * stretched to the window with nearest filtering. Dynamic resolution lowers
+ * the scale further while frames take longer than the budget. Screen-space
+ * UI lays out in window pixels, so it is drawn into the window after
+ * apply() rather than through drawScene().
+ *
+ * resize() is cheap: while the window is being dragged the old textures are
+ * stretched to the new size, and they are only reallocated once the size has
+ * settled for RESIZE_SETTLE seconds.
+ */
 class PostProcessing {
   public:
+    using Uniform = std::variant<float, sf::Vector2f, std::array<float, 4>>;
+    using DrawFunc = std::function<void(sf::RenderTarget&, const sf::View&)>;
+
+    static constexpr const char* DEFAULT_EFFECTS = "assets/shader/effects.json";
+
+    // dynamic resolution, budget suits vsync at 60 Hz
+    static constexpr float DEFAULT_FRAME_BUDGET = 1.f / 50.f;
+    static constexpr float MIN_DYNAMIC_SCALE = 0.5f;
+    static constexpr float DYNAMIC_STEP = 0.1f;
+    static constexpr float ADJUST_INTERVAL = 1.f; // seconds between changes
+
+    // seconds without a resize before the textures are reallocated
+    static constexpr float RESIZE_SETTLE = 0.15f;
+
     PostProcessing(unsigned int width, unsigned int height);
 
-    // Draw the scene to the internal render texture
-    void drawScene(const std::function<void(sf::RenderTarget&, const sf::View&)>& drawFunc, const sf::View* customView = nullptr);
+    // Replaces the chain with the passes of an effects file
+    void loadEffects(const std::string& path);
+
+    // Appends a fragment shader pass, false if the shader does not compile.
+    // scale is the resolution of the pass output relative to the window.
+    bool addPass(
+        const std::string& name, const std::string& shaderPath,
+        float scale = 1.f
+    );
+
+    void setPassEnabled(std::string_view name, bool enabled);
+    bool isPassEnabled(std::string_view name) const;
+
+    // Uploads "time" every frame, only needed by animated effects
+    void setPassAnimated(std::string_view name, bool animated);
+
+    // Master switch, e.g. for low-end machines
+    void setEffectsEnabled(bool enabled);
+
+    // Whether the scene goes through a render texture, either because a pass
+    // runs or because it is rendered below window resolution
+    bool isActive() const;
+
+    // Scene resolution relative to the window, 1 renders at native size
+    void setRenderScale(float scale);
+
+    // Renders about this many lines, upscaled by a whole factor, 0 disables.
+    // Takes precedence over the render scale.
+    void setVirtualHeight(unsigned int height);
 
-    // Apply post-processing effects and render to target
+    void setDynamicResolution(
+        bool enabled, float frameBudget = DEFAULT_FRAME_BUDGET
+    );
+
+    // Call once per frame with the frame time, applies settled resizes and
+    // feeds dynamic resolution
+    void update(float dt);
+
+    void setUniform(
+        std::string_view pass, const std::string& name, const Uniform& value
+    );
+
+    // Draw the scene, into the chain or directly into output
+    void drawScene(
+        sf::RenderTarget& output, const DrawFunc& drawFunc,
+        const sf::View* customView = nullptr
+    );
+
+    // Run the enabled passes and render the result to target
     void apply(sf::RenderTarget& target, float time);
 
     void resize(unsigned int width, unsigned int height);
 
-    // Get the internal render texture (if needed for direct access)
-    sf::RenderTexture& getRenderTexture() { return m_sceneTexture; }
+    sf::Vector2u getSize() const {
+        return { m_width, m_height };
+    }
+
+    // Size the scene is rendered at
+    sf::Vector2u getRenderSize() const {
+        return m_renderSize;
+    }
 
   private:
+    struct Pass {
+        std::string name;
+        std::unique_ptr<sf::Shader> shader;
+        float scale = 1.f;
+        bool enabled = true;
+        bool animated = false;
+        // last uploaded values
+        std::vector<std::pair<std::string, Uniform>> uniforms;
+    };
+
+    Pass* findPass(std::string_view name);
+    const Pass* findPass(std::string_view name) const;
+    static void
+    upload(Pass& pass, const std::string& name, const Uniform& value);
+    void updateTargets();
+    void updateRenderSize();
+    bool hasEnabledPass() const;
+
     unsigned int m_width;
     unsigned int m_height;
+    bool m_effectsEnabled = true;
+
+    float m_renderScale = 1.f;
+    unsigned int m_virtualHeight = 0;
+    sf::Vector2u m_renderSize;
+    sf::Vector2f m_outputScale{ 1.f, 1.f }; // scene to window
+
+    bool m_dynamic = false;
+    float m_frameBudget = DEFAULT_FRAME_BUDGET;
+    float m_dynamicScale = 1.f;
+    float m_frameTime = 0.f; // smoothed
+    float m_adjustTimer = 0.f;
+
+    bool m_resizePending = false;
+    float m_resizeTimer = 0.f; // since the last resize
 
-    sf::RenderTexture m_sceneTexture;
-    sf::Sprite m_sceneSprite;
-    sf::Shader m_shader;
+    std::vector<Pass> m_passes;
+    // ping-pong, only allocated while a pass is enabled
+    std::array<std::optional<sf::RenderTexture>, 2> m_targets;
 };
 
-#endif // POSTPROCESSING_H
\ No newline at end of file
+#endif // POSTPROCESSING_H
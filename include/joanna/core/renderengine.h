@@ -3,6 +3,7 @@
 #include "joanna/entities/enemy.h"
 #include "joanna/entities/interactable.h"
 #include "joanna/entities/player.h"
+#include "joanna/systems/interactionindex.h"
 #include "joanna/utils/dialogue_box.h"
 #include "joanna/world/tilemanager.h"
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -12,10 +13,12 @@ class RenderEngine {
   public:
     RenderEngine();
 
+    // dialogueBox may be null when the caller draws it with the other UI
     void render(
         sf::RenderTarget& target, Player& player, TileManager& tileManager,
         std::list<std::unique_ptr<Entity>>& entities,
-        const std::shared_ptr<DialogueBox>& dialogueBox, float dt
+        const std::shared_ptr<DialogueBox>& dialogueBox,
+        const InteractionTargets& interactions, float dt
     );
 
   private:
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "joanna/core/savegamemanager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Encodes GameState as JSON (readable, for debugging) or as a compact binary
+ * blob. The binary layout is a 16 byte header (magic "JSAV", version, payload
+ * size, CRC-32 of the payload) followed by little-endian fixed-width fields;
+ * strings (item ids, flag keys) are stored once in a string table and
+ * referenced by index.
+ */
+class SaveCodec {
+  public:
+    // 2 added region and play time, version 1 saves still load
+    static constexpr std::uint16_t VERSION = 2;
+
+    static std::vector<char> encodeBinary(const GameState& state);
+
+    // nullopt if the data is truncated, corrupted or of another version
+    static std::optional<GameState> decodeBinary(const std::vector<char>& data);
+
+    static std::string encodeJson(const GameState& state);
+
+    static std::optional<GameState> decodeJson(std::string_view text);
+
+    // Converters, return an empty result if the input cannot be decoded
+    static std::vector<char> jsonToBinary(std::string_view text);
+
+    static std::string binaryToJson(const std::vector<char>& data);
+
+    // The slot index file ("JSLI"), same header layout as a save
+    static std::vector<char>
+    encodeSlotIndex(const std::map<std::string, SlotInfo>& slots);
+
+    static std::optional<std::map<std::string, SlotInfo>>
+    decodeSlotIndex(const std::vector<char>& data);
+
+    static std::uint32_t crc32(const char* data, std::size_t size);
+};
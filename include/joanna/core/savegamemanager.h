@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
 #include <string>
-#include <unordered_set>
 #include <vector>
 #include <nlohmann/json.hpp>
 
@@ -15,7 +18,7 @@ struct PlayerState {
     int level = 1;
     int currentExp = 0;
     int expToNextLevel = 0;
-    std::unordered_set<std::string> visitedInteractions;
+    std::vector<std::string> visitedInteractions; // set flag keys
 };
 
 struct ItemState {
@@ -42,6 +45,27 @@ struct GameState {
     PlayerState player;
     InventoryState inventory;
     MapState map;
+    std::uint64_t rngSeed = 0; // 0 = keep the current seed (older saves)
+    std::string region;
+    std::uint32_t playTime = 0; // seconds
+
+    // RGB preview for the slot index, not part of the save itself
+    std::vector<std::uint8_t> thumbnail;
+};
+
+/**
+ * Summary of a save slot, kept in a small index file next to the saves so
+ * the slot list can be shown without reading the saves themselves.
+ */
+struct SlotInfo {
+    static constexpr unsigned THUMBNAIL_WIDTH = 32;
+    static constexpr unsigned THUMBNAIL_HEIGHT = 18;
+
+    std::int64_t savedAt = 0; // seconds since the epoch
+    int level = 1;
+    std::string region;
+    std::uint32_t playTime = 0; // seconds
+    std::vector<std::uint8_t> thumbnail; // RGB rows, empty if none
 };
 
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(PlayerState, x, y, health, attack, defense, level, currentExp, expToNextLevel, visitedInteractions)
@@ -49,19 +73,60 @@ NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(ItemState, id, quantity)
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(InventoryState, items)
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(ObjectState, id, gid, x, y)
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(MapState, items)
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(GameState, player, inventory, map)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(GameState, player, inventory, map, rngSeed, region, playTime)
+
+enum class SaveFormat : std::uint8_t { Json, Binary };
 
 class SaveGameManager {
   public:
     SaveGameManager();
 
-    void saveGame(const GameState& state, const std::string& index) const;
+    // Keeps the format the slot already uses, new slots are binary. The
+    // write is atomic, the previous save survives a failed or torn write.
+    bool saveGame(const GameState& state, const std::string& index) const;
+    bool saveGame(
+        const GameState& state, const std::string& index, SaveFormat format
+    ) const;
     [[nodiscard]] std::string getSaveInfo(const std::string& index) const;
+
+    // One entry per slot, nullopt for an empty slot. Reads only the index
+    // unless the save directory changed since it was written, then
+    // rebuilds the entries from the save files.
+    [[nodiscard]] std::vector<std::optional<SlotInfo>>
+    getSlotInfos(const std::vector<std::string>& indices) const;
+
+    // "Lv 3  Beach\nPlayed 1:02"
+    [[nodiscard]] static std::string describeSlot(const SlotInfo& info);
+
+    // "2026-01-31 18:05" in local time
+    [[nodiscard]] static std::string formatTimestamp(std::int64_t savedAt);
     [[nodiscard]] GameState loadGame(const std::string& index) const;
     [[nodiscard]] bool saveExists(const std::string& index) const;
 
+    [[nodiscard]] std::optional<SaveFormat>
+    getSlotFormat(const std::string& index) const;
+
+    // Rewrites the slot in the other format, false if it could not be read
+    bool convertSlot(const std::string& index, SaveFormat format) const;
+
   private:
     [[nodiscard]] std::filesystem::path getSaveDirectory() const;
+    [[nodiscard]] std::filesystem::path getIndexFilePath() const;
+    [[nodiscard]] std::map<std::string, SlotInfo> readSlotIndex() const;
+    [[nodiscard]] std::optional<SlotInfo>
+    readSlotInfoFromSave(const std::string& index) const;
+    [[nodiscard]] bool isSlotIndexCurrent() const;
+    // The save file alone, without touching the index
+    bool writeSave(
+        const GameState& state, const std::string& index, SaveFormat format
+    ) const;
+    void updateSlotIndex(const std::string& index, SlotInfo info) const;
+    // Read-modify-write of the index, serialized across threads
+    void editSlotIndex(
+        const std::function<void(std::map<std::string, SlotInfo>&)>& edit
+    ) const;
+    [[nodiscard]] std::filesystem::path
+    getSaveFilePath(const std::string& index, SaveFormat format) const;
     [[nodiscard]] std::filesystem::path getSaveFilePath(const std::string& index
     ) const;
 
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "joanna/core/savegamemanager.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Writes save games on a background I/O thread. The caller hands over a
+ * GameState snapshot taken on the main thread; serialization and the
+ * crash-safe write (temp file, fsync, rename) happen on the worker.
+ *
+ * A save to a slot that is still queued replaces the queued snapshot, so
+ * rapid saves coalesce. Completion callbacks run on the main thread from
+ * poll().
+ */
+class SaveWorker {
+  public:
+    using Callback = std::function<void(bool success)>;
+
+    // distinct slots that may wait at once, submit() blocks beyond that
+    static constexpr std::size_t MAX_PENDING = 4;
+
+    SaveWorker();
+    ~SaveWorker();
+
+    SaveWorker(const SaveWorker&) = delete;
+    SaveWorker& operator=(const SaveWorker&) = delete;
+
+    void submit(GameState state, std::string slot, Callback onDone = {});
+
+    // Runs the callbacks of finished saves, call once per frame
+    void poll();
+
+    // Blocks until every queued save is written, then polls
+    void flush();
+
+    bool isIdle() const;
+
+  private:
+    struct Job {
+        std::string slot;
+        GameState state;
+        std::vector<Callback> callbacks;
+    };
+
+    struct Result {
+        bool success = false;
+        std::vector<Callback> callbacks;
+    };
+
+    void run();
+
+    mutable std::mutex mutex;
+    std::condition_variable wake;    // worker waits for jobs
+    std::condition_variable drained; // submit() and flush() wait for space
+    std::deque<Job> pending;
+    std::vector<Result> finished;
+    bool writing = false;
+    bool stopping = false;
+    std::thread worker; // declared last, starts once the rest is built
+};
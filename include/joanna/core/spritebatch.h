@@ -0,0 +1,45 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Collects textured quads in draw order and flushes them with one draw call
+ * per run of quads sharing a texture. Sprites are transformed on the CPU, so
+ * many sprites from the same sheet cost a single call.
+ */
+class SpriteBatch {
+  public:
+    void add(const sf::Sprite& sprite);
+
+    void add(
+        const sf::Texture& texture, sf::FloatRect rect, sf::IntRect texRect,
+        sf::Color color = sf::Color::White
+    );
+
+    // Draws and clears the batch, the vertex storage is kept for reuse
+    void draw(sf::RenderTarget& target);
+
+    // draw calls the next draw() issues
+    std::size_t getDrawCalls() const {
+        return runs.size();
+    }
+
+  private:
+    struct Run {
+        const sf::Texture* texture;
+        std::size_t end; // one past the last vertex of the run
+    };
+
+    // Starts a new run unless the last one uses the same texture
+    void useTexture(const sf::Texture& texture);
+
+    std::vector<sf::Vertex> vertices;
+    std::vector<Run> runs;
+};
@@ -3,19 +3,22 @@
 #include "joanna/core/combattypes.h"
 #include "joanna/entities/entity.h"
 #include "joanna/entities/player.h"
+#include "joanna/systems/aischeduler.h"
 #include "joanna/world/tilemanager.h"
 #include "joanna/entities/entityutils.h"
+#include "joanna/utils/random.h"
 #include <unordered_map>
 #include <vector>
 
 class Enemy: public Entity {
   public:
-    enum class EnemyType { Goblin, Skeleton };
+    using EnemyType = ::EnemyType;
     Enemy(const sf::Vector2f& startPos, EnemyType type);
 
     static bool shouldTriggerCombat(float distToPlayer);
 
-    void update(float dt, State state);
+    // animate = false keeps the state but skips frame advancement (off-screen)
+    void update(float dt, State state, bool animate = true);
     void draw(sf::RenderTarget& target) const;
 
     void takeDamage(int amount);
@@ -41,12 +44,14 @@ class Enemy: public Entity {
     }
 
     enum class OverworldState { Idle, Pursuing };
-    int updateOverworld(float dt, Player& player, TileManager& tileManager);
+    int updateOverworld(
+        const AiTick& tick, Player& player, TileManager& tileManager
+    );
 
   private:
-    void updateAIState(float dt, const sf::Vector2f& myPos, const sf::Vector2f& playerPos, float distToPlayer, TileManager& tileManager);
+    void updateAIState(const AiTick& tick, const sf::Vector2f& myPos, const sf::Vector2f& playerPos, float distToPlayer, TileManager& tileManager);
     State handleIdleBehavior(float dt, const sf::Vector2f& myPos);
-    State handlePursuingBehavior(float dt, const sf::Vector2f& myPos, const sf::Vector2f& playerPos, float distToPlayer);
+    State handlePursuingBehavior(float dt, const sf::Vector2f& myPos, const sf::Vector2f& playerPos, float distToPlayer, const NavGrid& navGrid);
     void switchState(State newState);
     void applyFrame();
 
@@ -67,6 +72,8 @@ class Enemy: public Entity {
     sf::Vector2f patrolTarget;
     float patrolTimer = 0.f;
     float reactionTimer = 0.f;
+    bool hasLineOfSight = false; // refreshed when the AI scheduler allows
     float speed = 38.f;
     EnemyType type;
+    Pcg32 rng; // own generator, independent of update order
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "joanna/core/spritebatch.h"
 #include "joanna/entities/entityutils.h"
 #include <SFML/Graphics.hpp>
 #include <optional>
@@ -17,6 +18,9 @@ class Entity {
 
     void render(sf::RenderTarget& target) const;
 
+    // Queues the sprite instead of drawing it right away
+    void render(SpriteBatch& batch) const;
+
     uint32_t getId() const;
 
     void setTexture(const sf::Texture& texture);
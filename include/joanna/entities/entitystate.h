@@ -0,0 +1,7 @@
+#pragma once
+
+// Kept free of SFML so the headless combat simulator can use them
+
+enum class Direction { Left, Right };
+
+enum class State { Idle, Walking, Running, Attack, Roll, Hurt, Dead, Mining, Counter };
@@ -1,13 +1,11 @@
 #pragma once
 
+#include "joanna/entities/entitystate.h"
+
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <vector>
 
-enum class Direction { Left, Right };
-
-enum class State { Idle, Walking, Running, Attack, Roll, Hurt, Dead, Mining, Counter };
-
 struct Animation {
     sf::Texture texture;
     std::vector<sf::IntRect> frames;
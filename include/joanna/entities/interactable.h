@@ -10,6 +10,8 @@
 class Interactable: public Entity {
 
   public:
+    static constexpr float INTERACTION_DISTANCE = 16.f;
+
     Interactable(
         const sf::FloatRect& box, const std::string& buttonTexturePath,
         const std::string& spriteTexturePath,
@@ -27,5 +29,4 @@ class Interactable: public Entity {
 
   private:
     InteractionButton button;
-    const float interactionDistance = 16.f;
 };
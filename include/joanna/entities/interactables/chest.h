@@ -5,7 +5,10 @@
 
 class Chest: public Interactable {
   public:
-    Chest(const sf::Vector2f& position, std::string id);
+    Chest(
+        const sf::Vector2f& position, std::string id,
+        AudioManager& audioManager
+    );
 
     void interact(Player& player) override;
 
@@ -22,5 +25,5 @@ class Chest: public Interactable {
   private:
     bool isOpen = false;
     std::string id;
-    AudioManager audioManager;
+    AudioManager& audioManager;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "joanna/entities/interactable.h"
+#include "joanna/systems/flagregistry.h"
 
 class Stone: public Interactable {
   public:
@@ -15,11 +16,17 @@ class Stone: public Interactable {
         return id;
     }
 
+    // set on the player once the stone is broken
+    FlagId getFlag() const {
+        return flag;
+    }
+
   private:
     int stage = 0;
     bool waitingForHit = false;
     bool hasHitThisAnimation = false;
     std::string id;
+    FlagId flag;
 
     // Config
     const int miningHitFrame = 7; // Adjust based on animation
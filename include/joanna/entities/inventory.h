@@ -1,24 +1,32 @@
 #pragma once
 
+#include <bitset>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <SFML/Graphics.hpp>
 
 #include "joanna/core/savegamemanager.h"
-
-class TileManager;
+#include "joanna/entities/itemregistry.h"
+#include "joanna/systems/textcache.h"
 
 struct Item {
-    std::string id;   // unique identifier - tile id
-    std::string name; // display name
+    ItemId id = NO_ITEM;
     bool stackable = true;
 
     Item() = default;
 
-    Item(std::string id, std::string name, bool stackable = true);
+    // stackable defaults to the registry definition
+    explicit Item(ItemId id);
+
+    Item(ItemId id, bool stackable);
+
+    const ItemDefinition& definition() const;
+
+    const std::string& name() const {
+        return definition().name;
+    }
 };
 
 struct StoredItem {
@@ -36,21 +44,24 @@ class Inventory {
 
     std::uint32_t addItem(const Item& item, std::uint32_t quantity = 1);
 
-    std::uint32_t removeItem(const std::string& id, std::uint32_t quantity = 1);
-
-    bool hasItem(const std::string& id) const;
+    std::uint32_t removeItem(ItemId id, std::uint32_t quantity = 1);
 
-    bool hasItemByName(const std::string& name) const;
+    // Constant-time, backed by the per-item tables below
+    bool hasItem(ItemId id) const;
 
-    std::uint32_t getQuantity(const std::string& id) const;
+    // Total quantity over all slots holding the item
+    std::uint32_t getQuantity(ItemId id) const;
 
     std::size_t slotsUsed() const;
 
     const std::vector<StoredItem>& listItems() const;
 
-    std::string getSelectedItemId() const;
+    // NO_ITEM if the inventory is empty
+    ItemId getSelectedItemId() const;
 
-    void loadState(InventoryState& state);
+    void loadState(const InventoryState& state);
+
+    InventoryState saveState() const;
 
     void clear();
 
@@ -66,64 +77,65 @@ class Inventory {
 
     int getSelectedSlotIndex() const;
 
-    void drawSlot(
-        sf::RenderTarget& target, float slotSize, float padding,
-        sf::Vector2f startPos, std::size_t i, std::size_t col, std::size_t row,
-        sf::Vector2f& slotPos, bool isSelected
-    ) const;
-
     void drawItemName(
-        sf::RenderTarget& target, float slotSize, sf::Vector2f slotPos,
+        TextBatch& batch, float slotSize, sf::Vector2f slotPos,
         const StoredItem& st
     ) const;
 
     void drawItemQuantity(
-        sf::RenderTarget& target, float slotSize, sf::Vector2f slotPos,
+        TextBatch& batch, float slotSize, sf::Vector2f slotPos,
         const StoredItem& st
     ) const;
 
-    void drawItemSprite(
-        sf::RenderTarget& target, TileManager& tileManager, float slotSize,
-        sf::Vector2f slotPos, const StoredItem& st
-    ) const;
-
-    void drawItems(
-        sf::RenderTarget& target, TileManager& tileManager,
-        std::vector<StoredItem> vec, std::size_t columns, float slotSize,
-        float padding, std::size_t itemCount, sf::Vector2f startPos
-    ) const;
-
-    void
-    displayInventory(sf::RenderTarget& target, TileManager& tileManager) const;
+    // Draws the retained panel, rebuilt only after the inventory, the
+    // selection or the view center changed
+    void displayInventory(sf::RenderTarget& target) const;
 
     std::size_t capacity() const;
 
-    std::unordered_map<int, std::string> mapGidToName() const {
-        return idToString;
+    static bool isItemInvisible(const Item& item) {
+        return item.definition().invisible;
     }
 
-    bool isItemInvisible(int) const;
-
   private:
+    // Low ids, which covers every built-in item (quest tokens, tools), are
+    // mirrored in a bitset for the checks that run every frame
+    static constexpr std::size_t FLAG_COUNT = 64;
+    static constexpr std::uint32_t NO_SLOT = 0xFFFFFFFFu;
+
     void checkInventoryInvisibleBounds();
 
+    void changeQuantity(ItemId id, std::uint32_t added, std::uint32_t removed);
+
+    // Rebuilds the slot index after slots were inserted or erased
+    void reindexSlots();
+
+    void rebuildIndex();
+
+    void rebuildPanel(sf::Vector2f viewCenter) const;
+
+    void appendItemIcon(
+        float slotSize, sf::Vector2f slotPos, const StoredItem& st
+    ) const;
+
     std::size_t selectedSlotIndex = 0;
 
-    sf::Font font;
+    const sf::Font* font; // owned by the ResourceManager
+    mutable TextBatch textBatch; // debug listing
+    const sf::Texture* iconAtlas; // tileset, holds every item icon
     std::vector<StoredItem> items_;
     std::size_t capacity_;
-    std::vector<int> invisibleItemIds = { 3056, 3055 };
-    std::unordered_map<int, std::string> idToString = {
-        { 691, "carrot" },
-        { 3050, "sword" },
-        { 3056, "piratToken" },    // invisible
-        { 3055, "counterAttack" }, // invisible
-        { 627, "key" },
-        { 628, "bone" },
-        { 629, "shield" },
-        { 630, "grade" },
-        { 703, "mushroom" },
-        { 1330, "heal" },
-        { 3113, "pickaxe" },
-    };
+
+    // indexed by ItemId, grown on demand
+    std::vector<std::uint32_t> quantities;
+    std::vector<std::uint32_t> firstSlot;
+    std::bitset<FLAG_COUNT> flags;
+    std::size_t firstInvisibleSlot = 0; // invisible items are kept last
+
+    // retained inventory panel
+    mutable std::vector<sf::Vertex> panelVertices; // background and slots
+    mutable std::vector<sf::Vertex> iconVertices;
+    mutable TextBatch panelLabels;
+    mutable sf::Vector2f panelCenter;
+    mutable bool panelDirty = true;
 };
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Compact item handle, an index into the ItemRegistry definition table
+using ItemId = std::uint16_t;
+
+inline constexpr ItemId NO_ITEM = 0xFFFF;
+
+// Built-in items, registered in this order so their ids are compile-time
+// constants
+namespace Items {
+inline constexpr ItemId Carrot = 0;
+inline constexpr ItemId Sword = 1;
+inline constexpr ItemId PiratToken = 2;
+inline constexpr ItemId CounterAttack = 3;
+inline constexpr ItemId Key = 4;
+inline constexpr ItemId Bone = 5;
+inline constexpr ItemId Shield = 6;
+inline constexpr ItemId Grade = 7;
+inline constexpr ItemId Mushroom = 8;
+inline constexpr ItemId Heal = 9;
+inline constexpr ItemId Pickaxe = 10;
+} // namespace Items
+
+struct ItemDefinition {
+    std::uint32_t gid = 0; // tile id in the tileset
+    std::string name;      // display name
+    bool stackable = true;
+    bool invisible = false; // hidden from the inventory UI
+    sf::IntRect iconRect;   // icon in assets/environment/map/tileset.png
+};
+
+/**
+ * Central table of every item the game knows about. Tile gids are only
+ * translated at the boundaries (map pickups, dialogue data, save files); the
+ * rest of the game passes ItemIds around and looks definitions up by index.
+ */
+class ItemRegistry {
+  public:
+    static ItemRegistry& getInstance();
+
+    ItemRegistry(const ItemRegistry&) = delete;
+    ItemRegistry& operator=(const ItemRegistry&) = delete;
+
+    // Returns the id for gid, registering it with the given name if unknown
+    ItemId intern(std::uint32_t gid, std::string_view name = {});
+
+    std::optional<ItemId> findByGid(std::uint32_t gid) const;
+
+    const ItemDefinition& get(ItemId id) const {
+        return definitions.at(id);
+    }
+
+    bool isKnown(ItemId id) const {
+        return id < definitions.size();
+    }
+
+    std::size_t size() const {
+        return definitions.size();
+    }
+
+    // Save/load boundary, items are stored by their gid as text
+    std::string toString(ItemId id) const;
+    ItemId fromString(const std::string& gidText);
+
+    static sf::IntRect tileRect(std::uint32_t gid);
+
+  private:
+    ItemRegistry();
+
+    ItemId add(ItemDefinition definition);
+
+    static constexpr int TILE_SIZE = 16;
+    static constexpr int TILESET_COLUMNS = 64;
+
+    std::vector<ItemDefinition> definitions;
+    std::unordered_map<std::uint32_t, ItemId> byGid;
+};
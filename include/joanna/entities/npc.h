@@ -4,18 +4,22 @@
 #include "joanna/entities/interactable.h"
 #include "joanna/entities/inventory.h"
 #include "joanna/entities/player.h"
+#include "joanna/systems/dialoguetable.h"
 #include "joanna/utils/dialogue_box.h"
+#include "joanna/world/navgrid.h"
 #include "nlohmann/json.hpp"
 #include <SFML/Graphics.hpp>
 #include <deque>
 #include <optional>
+#include <span>
 #include <unordered_map>
 
 using json = nlohmann::json;
 
 class NPC: public Interactable {
   public:
-    static json jsonData;
+    static DialogueTable dialogues; // compiled dialog.json, set at startup
+    static NavGrid* navGrid; // used to route waypoints around obstacles
     NPC(const sf::Vector2f& startPos, const std::string& npcIdlePath,
         const std::string& npcWalkingPath, const std::string& buttonTexturePath,
         std::shared_ptr<DialogueBox> dialogueBox, std::string dialogId);
@@ -38,9 +42,12 @@ class NPC: public Interactable {
         return uniqueSpriteId;
     }
 
+    // Flag marking the dialogue entry with the given id as seen
+    FlagId flagFor(std::string_view entryId) const;
+
     void applyFrame();
 
-    void move(const json& moveData);
+    void move(const std::vector<sf::Vector2f>& steps);
 
   private:
     State currentState = State::Idle;
@@ -52,13 +59,15 @@ class NPC: public Interactable {
     void switchState(State newState);
     std::string uniqueSpriteId;
     std::deque<sf::Vector2f> movementQueue;
+    std::vector<sf::Vector2f> pathBuffer;
     std::unordered_map<State, Animation> animations;
     std::shared_ptr<DialogueBox> dialogueBox;
     std::string dialogId;
     std::optional<Item> pendingReward;
-    std::optional<json> pendingMove;
-    std::string pendingActionId;
-    std::vector<nlohmann::json> sortedDialogue;
+    const DialogueEntry* pendingMove = nullptr;
+    std::uint32_t pendingActionId = DialogueEntry::NO_ID;
+    std::span<const DialogueEntry> dialogue; // sorted, owned by dialogues
+    std::vector<FlagId> visitedFlags; // per entry, NO_FLAG if no id
     std::function<void(const std::string&)> onAction;
 
   public:
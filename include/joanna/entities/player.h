@@ -6,6 +6,7 @@
 #include "./stats.h"
 #include "joanna/core/combattypes.h"
 #include "joanna/systems/audiomanager.h"
+#include "joanna/systems/flagregistry.h"
 #include "joanna/world/tilemanager.h"
 
 #include <SFML/Graphics.hpp>
@@ -34,9 +35,7 @@ class Player: public Entity {
     void draw(sf::RenderTarget& target) const;
     void addItemToInventory(const Item& item, std::uint32_t quantity = 1);
     void takeDamage(int amount);
-    bool applyItem(const std::string& itemId);
-    void
-    displayHealthBar(sf::RenderTarget& target, TileManager& tileManager) const;
+    bool applyItem(ItemId itemId);
 
     int getHealth() const {
         return health;
@@ -56,12 +55,16 @@ class Player: public Entity {
         return stats;
     }
 
-    bool hasInteraction(const std::string& id) const {
-        return visitedInteractions.find(id) != visitedInteractions.end();
+    const Stats& getStats() const {
+        return stats;
+    }
+
+    bool hasFlag(FlagId id) const {
+        return flags.test(id);
     }
 
-    void addInteraction(const std::string& id) {
-        visitedInteractions.insert(id);
+    void setFlag(FlagId id) {
+        flags.set(id);
     }
 
     void gainExp(int amount);
@@ -91,18 +94,18 @@ class Player: public Entity {
         expToNextLevel = newExpToNextLevel;
     }
 
-    std::unordered_set<std::string> getVisitedInteractions() const {
-        return visitedInteractions;
+    const FlagSet& getFlags() const {
+        return flags;
     }
 
-    void resetInteractions() {
-        visitedInteractions.clear();
+    void resetFlags() {
+        flags.reset();
     }
 
     void resetStats();
 
-    void setInteractions(const std::unordered_set<std::string>& interactions) {
-        visitedInteractions = interactions;
+    void setFlags(const FlagSet& newFlags) {
+        flags = newFlags;
     }
 
     using LevelUpListener = std::function<void(int)>;
@@ -129,5 +132,5 @@ class Player: public Entity {
 
     void switchState(State newState);
     void applyFrame();
-    std::unordered_set<std::string> visitedInteractions;
+    FlagSet flags; // visited interactions and quest progress
 };
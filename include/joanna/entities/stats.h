@@ -1,5 +1,4 @@
 #pragma once
-#include <SFML/Graphics.hpp>
 
 class Stats {
     public:
@@ -8,6 +7,4 @@ class Stats {
         Stats(int attack, int defense);
         int attack;
         int defense;
-
-        void draw(sf::RenderTarget& target, const sf::Font& font, int currentExp, int expToNextLevel) const;
-};
\ No newline at end of file
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "joanna/core/combattypes.h"
+
+#include <cstdint>
+
+/**
+ * Plays an attack's precomputed timeline. advance() only ever moves
+ * forward and looks at the next key, so a step is O(1) no matter how many
+ * fields the attack has.
+ */
+class AttackCursor {
+  public:
+    using Events = std::uint8_t; // bit mask of AttackEvents
+
+    static constexpr Events bit(AttackEvent event) {
+        return static_cast<Events>(1u << static_cast<unsigned>(event));
+    }
+
+    void start(const Attack& attack);
+
+    // Moves the time forward, returns the events reached on the way
+    Events advance(float dt);
+
+    float getTime() const {
+        return time;
+    }
+
+    bool hasPassed(AttackEvent event) const {
+        return (passed & bit(event)) != 0;
+    }
+
+    bool isCounterOpen() const {
+        return hasPassed(AttackEvent::CounterOpen) &&
+               !hasPassed(AttackEvent::CounterClose);
+    }
+
+    bool isDone() const {
+        return hasPassed(AttackEvent::End);
+    }
+
+  private:
+    std::array<AttackKey, 4> keys{}; // copied, attacks may be reassigned
+    std::uint8_t size = 0;
+    std::uint8_t next = 0;
+    Events passed = 0;
+    float time = 0.f;
+};
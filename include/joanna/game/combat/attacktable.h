@@ -0,0 +1,66 @@
+#pragma once
+
+#include "joanna/core/combattypes.h"
+#include "nlohmann/json.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class PlayerAction : std::uint8_t {
+    Attack, // needs the sword
+    Roll
+};
+
+struct EnemyDefinition {
+    std::string name;
+    int health = 100;
+    std::vector<Attack> attacks;
+};
+
+/**
+ * assets/combat/attacks.json compiled once: the player's attacks and the
+ * health and attacks of every enemy, each attack with its timeline already
+ * built. Enemies are looked up by name, so new ones only need data.
+ */
+class AttackTable {
+  public:
+    static constexpr const char* DEFAULT_PATH = "assets/combat/attacks.json";
+
+    // Throws if a required field is missing
+    static AttackTable compile(const nlohmann::json& data);
+
+    // The data file getInstance() compiles, call before its first use
+    static void setPath(std::string path);
+
+    // Compiled on first use; throws if it cannot be loaded
+    static const AttackTable& getInstance();
+
+    const Attack& getPlayerAttack(PlayerAction action) const {
+        return playerAttacks.at(static_cast<std::size_t>(action));
+    }
+
+    // Sorted by name, the data is read as a sorted JSON object
+    const std::vector<EnemyDefinition>& getEnemies() const {
+        return enemies;
+    }
+
+    // nullptr if there is no enemy with that name
+    const EnemyDefinition* findEnemy(std::string_view name) const;
+
+    // Throws if the data has no enemy with that name
+    const EnemyDefinition& getEnemy(std::string_view name) const;
+
+    // Enemies placed from code, throws if the data lacks them
+    const EnemyDefinition& getEnemy(EnemyType type) const;
+
+    static std::string_view getName(EnemyType type);
+
+    // Sorts the impact, end and counter window times into attack.timeline
+    static void buildTimeline(Attack& attack);
+
+  private:
+    std::array<Attack, 2> playerAttacks; // by PlayerAction
+    std::vector<EnemyDefinition> enemies;
+};
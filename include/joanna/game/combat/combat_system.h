@@ -1,8 +1,12 @@
 #pragma once
 
 #include "joanna/core/combattypes.h"
+#include "joanna/core/spritebatch.h"
 #include "joanna/entities/enemy.h"
 #include "joanna/entities/player.h"
+#include "joanna/game/combat/attackcursor.h"
+#include "joanna/game/combat/damageindicators.h"
+#include "joanna/systems/inputrecorder.h"
 #include <SFML/Graphics.hpp>
 
 struct EntityState {
@@ -13,7 +17,7 @@ struct EntityState {
 
 class CombatSystem {
   public:
-    CombatSystem();
+    explicit CombatSystem(AudioManager& audioManager);
 
     void startCombat(Player& player, Enemy& enemy);
     void endCombat();
@@ -22,7 +26,7 @@ class CombatSystem {
         sf::RenderTarget& target, class TileManager& tileManager,
         const sf::Font& font
     );
-    void handleInput(sf::Event& event);
+    void handleInput(const InputSnapshot& input);
 
     CombatState getState() const {
         return currentState;
@@ -43,7 +47,7 @@ class CombatSystem {
         Countering
     };
 
-    AudioManager audioManager;
+    AudioManager& audioManager;
 
     EntityState playerState;
     EntityState enemyState;
@@ -62,12 +66,19 @@ class CombatSystem {
     CombatState currentState = CombatState::PlayerTurn;
     TurnPhase phase = TurnPhase::Input;
 
-    float turnTimer = 0.0f;
+    float turnTimer = 0.0f; // time into a counter
     float victoryTimer = 0.0f;
 
+    // combat plays a little slower than real time, for the animations
+    static constexpr float TIME_SCALE = 0.6f;
+    static constexpr float STEP = 1.f / 120.f;
+    static constexpr float MAX_STEPS = 8.f; // per frame, drops time beyond
+    float stepTime = 0.0f;                  // not yet simulated
+
     sf::Vector2f startPos;
     sf::Vector2f targetPos;
     Attack currentAttack;
+    AttackCursor attackCursor;
 
     State pState = State::Idle;
     State eState = State::Idle;
@@ -76,6 +87,7 @@ class CombatSystem {
     bool counterSuccess = false;
     bool damageDealt = false;
 
+    void step(float dt);
     void updatePlayerTurn(float dt, State& pState, State& eState);
     void updateEnemyTurn(float dt, State& pState, State& eState);
     void processApproach(
@@ -106,17 +118,9 @@ class CombatSystem {
         const Attack& attack, Attacker* attacker
     );
 
-    struct DamageIndicator {
-        sf::Vector2f position;
-        std::string text;
-        sf::Color color;
-        float lifeTime;
-        float maxLifeTime;
-        float speed;
-    };
-
-    std::vector<DamageIndicator> damageTexts;
-    sf::Font damageFont;
+    DamageIndicatorPool damageIndicators;
+    SpriteBatch spriteBatch;
+    TextBatch indicatorText;
 
     void spawnDamageText(Entity* target, int amount);
 };
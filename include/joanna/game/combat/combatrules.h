@@ -0,0 +1,57 @@
+#pragma once
+
+#include "joanna/core/combattypes.h"
+#include "joanna/game/combat/attacktable.h"
+#include "joanna/utils/random.h"
+
+#include <cstdint>
+#include <vector>
+
+// Health and stats of one side of a fight
+struct Combatant {
+    int health = 0;
+    int attack = 0;
+    int defense = 0;
+
+    bool isDead() const {
+        return health <= 0;
+    }
+};
+
+/**
+ * The combat rules without any rendering or timing: stats, damage and
+ * counter windows. Attacks and enemy health come from the AttackTable.
+ * CombatSystem plays them out with animations, CombatSim resolves whole
+ * fights headless for balance runs.
+ */
+class CombatRules {
+  public:
+    static constexpr int COUNTER_DAMAGE = 10;
+    static constexpr int VICTORY_EXP = 5;
+
+    static constexpr int PLAYER_HEALTH = 200;
+    static constexpr int BASE_ATTACK = 10;
+    static constexpr int BASE_DEFENSE = 10;
+    static constexpr int ATTACK_PER_LEVEL = 2;
+    static constexpr int DEFENSE_PER_LEVEL = 1;
+    static constexpr int SWORD_ATTACK = 3;   // while the sword is owned
+    static constexpr int SHIELD_DEFENSE = 3; // while the shield is owned
+
+    // A player at full health with the stats of that level and equipment
+    static Combatant
+    player(int level, bool hasSword = false, bool hasShield = false);
+    static Combatant enemy(const EnemyDefinition& definition);
+    static Combatant enemy(EnemyType type);
+
+    static const Attack& playerAttack(PlayerAction action);
+    static const std::vector<Attack>& enemyAttacks(EnemyType type);
+
+    static const Attack&
+    chooseAttack(const std::vector<Attack>& attacks, Pcg32& rng);
+
+    static int damageToEnemy(const Attack& attack, int playerAttack);
+    static int damageToPlayer(const Attack& attack, int playerDefense);
+
+    // Whether a counter pressed this far into the attack succeeds
+    static bool inCounterWindow(const Attack& attack, float time);
+};
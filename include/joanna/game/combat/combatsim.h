@@ -0,0 +1,66 @@
+#pragma once
+
+#include "joanna/game/combat/combatrules.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct FightSetup {
+    int level = 1;
+    std::string enemy = "goblin"; // name in the AttackTable
+    bool hasSword = true;
+    bool hasShield = false;
+    bool canCounter = false;  // owns the counter attack item
+    float counterSkill = 0.f; // chance to press inside a counter window
+};
+
+struct FightResult {
+    bool won = false;
+    int turns = 0;        // attacks of both sides
+    float duration = 0.f; // seconds of attack animations
+    int damageDealt = 0;
+    int damageTaken = 0;
+};
+
+// Aggregate of many fights, histograms are indexed by value
+struct FightStats {
+    std::uint64_t fights = 0;
+    std::uint64_t wins = 0;
+    double duration = 0.0;
+    std::vector<std::uint64_t> turns;
+    std::vector<std::uint64_t> damageTaken;
+
+    void add(const FightResult& result);
+    void merge(const FightStats& other);
+
+    double winRate() const;
+    double meanDuration() const;
+
+    // Smallest value at or below which the fraction q of fights lies
+    static std::size_t
+    percentile(const std::vector<std::uint64_t>& histogram, double q);
+    static double mean(const std::vector<std::uint64_t>& histogram);
+};
+
+/**
+ * Resolves fights with the CombatRules, without entities, rendering or
+ * frame timing. The player always uses its best attack and counters with
+ * the given skill. Results depend only on the setup and the generator.
+ */
+class CombatSim {
+  public:
+    static constexpr int MAX_TURNS = 1000; // counted as a loss
+
+    // Throw if the AttackTable has no enemy named setup.enemy
+    static FightResult fight(const FightSetup& setup, Pcg32& rng);
+
+    static FightStats
+    run(const FightSetup& setup, std::uint64_t fights, Pcg32& rng);
+
+  private:
+    static FightResult fight(
+        const FightSetup& setup, const EnemyDefinition& definition, Pcg32& rng
+    );
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "joanna/systems/textcache.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed-capacity ring of floating damage numbers. Spawning never allocates,
+ * a full ring replaces its oldest indicator. The numbers are drawn from
+ * TextCache layouts into a TextBatch, so any number of indicators costs one
+ * draw call per font page.
+ */
+class DamageIndicatorPool {
+  public:
+    static constexpr std::size_t CAPACITY = 32;
+
+    void spawn(
+        sf::Vector2f position, int amount, sf::Color color = sf::Color::White,
+        float lifeTime = 1.f, float speed = 100.f
+    );
+
+    // Moves the indicators up and retires the expired ones
+    void update(float dt);
+
+    void clear();
+
+    void appendTo(TextBatch& batch, const sf::Font& font) const;
+
+    std::size_t size() const {
+        return count;
+    }
+
+  private:
+    struct Indicator {
+        sf::Vector2f position;
+        sf::Color color;
+        float lifeTime = 0.f;
+        float maxLifeTime = 1.f;
+        float speed = 0.f;
+        std::array<char, 12> text{}; // fits any int
+        std::uint8_t length = 0;
+    };
+
+    const Indicator& at(std::size_t i) const {
+        return ring.at((head + i) % CAPACITY);
+    }
+
+    std::array<Indicator, CAPACITY> ring{};
+    std::size_t head = 0; // oldest live indicator
+    std::size_t count = 0;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <unordered_map>
+
+enum class AiTier : std::uint8_t { Active, Background, Dormant };
+
+// What an actor may do this frame, handed out by AIScheduler::schedule()
+struct AiTick {
+    bool run = true;            // false: skip the actor entirely this frame
+    float dt = 0.f;             // time to integrate, incl. skipped frames
+    bool visible = true;        // false: do not advance animation frames
+    bool refreshSight = true;   // false: reuse the last line-of-sight result
+    AiTier tier = AiTier::Active;
+};
+
+/**
+ * Level-of-detail scheduler for overworld AI.
+ *
+ * Actors on screen or near the player update every frame. Off-screen actors
+ * update every few frames with the accumulated time, and far away actors are
+ * dormant until they come back into range, then catch up in one capped step.
+ * Line-of-sight checks are time-sliced across frames within a fixed budget.
+ */
+class AIScheduler {
+  public:
+    struct Config {
+        float activeRadius = 160.f;  // always full rate inside this radius
+        float dormantRadius = 640.f; // no updates at all beyond this radius
+        int backgroundInterval = 4;  // frames between off-screen updates
+        int sightInterval = 3;       // frames a line-of-sight result is kept
+        int sightBudget = 8;         // line-of-sight checks per frame
+        float maxCatchUp = 0.5f;     // cap for the dt handed out on wake
+    };
+
+    AIScheduler() = default;
+    explicit AIScheduler(const Config& config) : config(config) {}
+
+    // Call once per frame before scheduling any actor
+    void beginFrame(const sf::FloatRect& view, sf::Vector2f playerPos);
+
+    AiTick schedule(std::uint32_t id, sf::Vector2f position, float dt);
+
+    // Drop the bookkeeping of a removed actor
+    void forget(std::uint32_t id);
+
+    void clear();
+
+    AiTier classify(sf::Vector2f position) const;
+
+  private:
+    struct Slot {
+        float pendingDt = 0.f;
+        std::uint64_t lastSightFrame = 0;
+        bool hasSight = false;
+    };
+
+    Config config;
+    std::unordered_map<std::uint32_t, Slot> slots;
+    sf::FloatRect view;
+    sf::Vector2f playerPos;
+    std::uint64_t frame = 0;
+    int sightChecks = 0;
+};
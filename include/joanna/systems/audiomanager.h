@@ -1,23 +1,11 @@
 #pragma once
 
+#include "joanna/systems/musicplayer.h"
+#include "joanna/systems/sfxplayer.h"
+
 #include <SFML/Audio.hpp>
 #include <memory>
-#include <string>
-
-enum class SfxId : std::uint8_t {
-    Hit,
-    Footstep,
-    Dead,
-    Surprise,
-    Collect,
-    Damage,
-    Click,
-    Break,
-    Chest
-    // These are not all SFX. More in assets/sfx folder.
-};
-
-enum class MusicId : std::uint8_t { Overworld, Underworld, Beach, Combat, GameOver };
+#include <string_view>
 
 class AudioManager {
   public:
@@ -29,8 +17,25 @@ class AudioManager {
     AudioManager(AudioManager&&) = default;
     AudioManager& operator=(AudioManager&&) = default;
 
+    // Queued until update(), see SfxPlayer
     void play_sfx(SfxId sfx_id);
+    // Quieter the farther the position is from the listener
+    void play_sfx(SfxId sfx_id, sf::Vector2f position);
+    // Sounds only named in the manifest, see find_sfx()
+    void play_sfx(SoundId sound_id);
+    void play_sfx(SoundId sound_id, sf::Vector2f position);
+    [[nodiscard]] static SoundId find_sfx(std::string_view name);
+    void set_listener_position(sf::Vector2f position);
+    void stop_sfx();
+
+    // Crossfades to the track, see MusicPlayer
     void set_current_music(MusicId music_id);
+    void prefetch_music(MusicId music_id);
+    void set_music_crossfade(float seconds);
+
+    // Starts the queued sound effects and advances music fades, call once
+    // per frame
+    void update(float dt);
 
     void set_sfx_volume(float volume);
     void set_music_volume(float volume);
@@ -41,11 +46,8 @@ class AudioManager {
     [[nodiscard]] bool is_music_playing() const;
 
   private:
-    [[nodiscard]] std::string get_sfx_path(SfxId sfx_id) const;
-    [[nodiscard]] std::string get_music_path(MusicId music_id) const;
-
-    std::array<std::unique_ptr<sf::Sound>, 9> sounds_;
-    sf::Music current_music_;
+    std::unique_ptr<SfxPlayer> sfx_;
+    std::unique_ptr<MusicPlayer> music_; // owns a thread, kept movable
 
     float sfx_volume_;
     float music_volume_;
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Index into the AudioManifest sound table
+using SoundId = std::uint16_t;
+
+inline constexpr SoundId NO_SOUND = 0xFFFF;
+
+enum class SoundLoad : std::uint8_t {
+    Preload, // decoded at startup
+    Lazy,    // decoded the first time it plays
+    Stream   // streamed from disk, for music
+};
+
+struct SoundGroup {
+    std::string name;
+    float volume = 1.f; // 0 - 1
+};
+
+struct SoundDefinition {
+    std::string name;
+    std::string path;
+    SoundLoad load = SoundLoad::Preload;
+    std::uint8_t group = 0; // index into the group table
+    float volume = 1.f;     // 0 - 1
+    std::uint8_t maxInstances = 2;
+    std::uint8_t priority = 0; // higher steals voices from lower
+};
+
+/**
+ * assets/audio/audio.json compiled once at startup into flat tables. Sounds
+ * are looked up by name once and afterwards addressed by SoundId, so new
+ * clips only need a manifest entry.
+ */
+class AudioManifest {
+  public:
+    static constexpr const char* DEFAULT_PATH = "assets/audio/audio.json";
+
+    static AudioManifest compile(const nlohmann::json& data);
+
+    // DEFAULT_PATH, compiled on first use; empty if the file is unreadable
+    static const AudioManifest& getInstance();
+
+    // NO_SOUND if there is no sound with that name
+    SoundId find(std::string_view name) const;
+
+    const SoundDefinition& get(SoundId id) const {
+        return sounds.at(id);
+    }
+
+    const SoundGroup& getGroup(std::uint8_t group) const {
+        return groups.at(group);
+    }
+
+    // Volume of the sound times the volume of its group
+    float getVolume(SoundId id) const;
+
+    std::size_t size() const {
+        return sounds.size();
+    }
+
+  private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view key) const {
+            return std::hash<std::string_view>{}(key);
+        }
+    };
+
+    std::vector<SoundDefinition> sounds;
+    std::vector<SoundGroup> groups;
+    std::unordered_map<std::string, SoundId, Hash, std::equal_to<>> ids;
+};
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "audiomanager.h"
+#include "inputrecorder.h"
 #include "joanna/core/renderengine.h"
 #include "joanna/core/windowmanager.h"
 #include "joanna/entities/interactable.h"
 #include "joanna/entities/player.h"
+#include "joanna/systems/interactionindex.h"
 #include "joanna/utils/dialogue_box.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -52,10 +54,26 @@ class Controller {
         return player;
     }
 
+    InteractionIndex& getInteractions() {
+        return interactions;
+    }
+
     bool renderInventory() const {
         return displayInventory;
     }
 
+    // Samples the live keyboard into a snapshot (dt is left for the caller)
+    static InputSnapshot sampleKeyboard();
+
+    void setInput(const InputSnapshot& snapshot) {
+        input = snapshot;
+    }
+
+    // Replays cannot drive the blocking menu, so it can be disabled
+    void setMenuEnabled(bool enabled) {
+        menuEnabled = enabled;
+    }
+
   private:
     WindowManager& windowManager;
     AudioManager& audioManager;
@@ -69,6 +87,10 @@ class Controller {
 
     bool showMapOverview = false;
     bool mPressed = false;
+    bool menuEnabled = true;
+
+    InputSnapshot input;
+    InteractionIndex interactions;
 
     int counter = 0;
 };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "joanna/entities/inventory.h"
+#include "nlohmann/json.hpp"
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+enum class RequirementType : std::uint8_t { None, Item, ItemRemove };
+
+struct DialogueRequirement {
+    RequirementType type = RequirementType::None;
+    ItemId item = NO_ITEM;
+    std::uint32_t amount = 0;
+};
+
+struct DialogueEntry {
+    static constexpr std::uint32_t NO_ID = 0xFFFFFFFFu;
+
+    int priority = 0;
+    std::uint32_t id = NO_ID; // interned, see DialogueTable::getName()
+    DialogueRequirement requirement;
+    std::vector<std::string> text;
+    std::optional<Item> reward;
+    bool hasMove = false;
+    std::vector<sf::Vector2f> move; // relative steps
+};
+
+/**
+ * dialog.json compiled once at startup. Entries of every NPC are stored
+ * sorted by priority (highest first) in one flat array that all NPCs share,
+ * so an interaction is a walk over plain structs without any JSON access.
+ */
+class DialogueTable {
+  public:
+    static DialogueTable compile(const nlohmann::json& data);
+
+    // Entries of one dialogue id, empty if the id is unknown
+    std::span<const DialogueEntry> getEntries(std::string_view dialogId) const;
+
+    // Interned entry id, DialogueEntry::NO_ID if it never occurs
+    std::uint32_t findId(std::string_view name) const;
+
+    const std::string& getName(std::uint32_t id) const {
+        return names.at(id);
+    }
+
+  private:
+    struct Range {
+        std::size_t first = 0;
+        std::size_t count = 0;
+    };
+
+    std::uint32_t intern(const std::string& name);
+
+    std::vector<DialogueEntry> entries;
+    std::unordered_map<std::string, Range> scripts;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::uint32_t> nameIds;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using FlagId = std::uint32_t;
+
+inline constexpr FlagId NO_FLAG = 0xFFFFFFFFu;
+
+// Flags set from code, registered first so their ids are constants
+namespace Flags {
+inline constexpr FlagId ChestOpened = 0;
+inline constexpr FlagId GoblinDead = 1;
+} // namespace Flags
+
+/**
+ * Maps interaction/quest keys ("chestOpened", "<npc sprite>_<dialogue id>",
+ * stone ids, ...) to dense indices. Keys are interned once when the owning
+ * entity is built, afterwards every check is a bit test on a FlagSet.
+ */
+class FlagRegistry {
+  public:
+    static FlagRegistry& getInstance();
+
+    FlagRegistry(const FlagRegistry&) = delete;
+    FlagRegistry& operator=(const FlagRegistry&) = delete;
+
+    FlagId intern(std::string_view key);
+
+    // NO_FLAG if the key was never interned
+    FlagId find(std::string_view key) const;
+
+    const std::string& getName(FlagId id) const {
+        return names.at(id);
+    }
+
+    std::size_t size() const {
+        return names.size();
+    }
+
+  private:
+    FlagRegistry();
+
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view key) const {
+            return std::hash<std::string_view>{}(key);
+        }
+    };
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, FlagId, Hash, std::equal_to<>> ids;
+};
+
+/**
+ * Dynamic bitset indexed by FlagId.
+ */
+class FlagSet {
+  public:
+    bool test(FlagId id) const {
+        const std::size_t word = id / 64;
+        return word < words.size() && ((words[word] >> (id % 64)) & 1u) != 0;
+    }
+
+    void set(FlagId id);
+
+    void reset() {
+        words.clear();
+    }
+
+    bool any() const;
+
+    // Save/load boundary, flags are stored by key so saves survive new
+    // flags being added
+    std::vector<std::string> toKeys() const;
+    static FlagSet fromKeys(const std::vector<std::string>& keys);
+
+  private:
+    std::vector<std::uint64_t> words;
+};
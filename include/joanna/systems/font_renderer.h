@@ -5,6 +5,7 @@
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include "joanna/systems/textcache.h"
 #include <string>
 #include <cstdint>
 
@@ -45,16 +46,26 @@ class FontRenderer {
         uint32_t options = NONE
     );
 
+    // Collect drawText() calls and draw them with one call per font page in
+    // endBatch(). drawTextUI() is not batched, it switches the view.
+    void beginBatch();
+    void endBatch(sf::RenderTarget& target);
+
     // Get the font for direct access if needed
     const sf::Font& getFont() const;
 
   private:
-    sf::Font font;
+    const sf::Font* font; // owned by the ResourceManager, shared page cache
     bool loaded;
+    bool batching = false;
+    TextBatch batch;
     static constexpr float letterSpacing = 1.5f;
 
-    // Helper to apply centering
-    void applyAlignment(sf::Text& text, const sf::Vector2f& position, uint32_t options);
+    // Helper to apply centering, returns the top-left offset of the layout
+    static sf::Vector2f applyAlignment(
+        const TextLayout& layout, const sf::Vector2f& position,
+        uint32_t options
+    );
 
     // Internal draw implementation
     void drawTextImpl(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "joanna/core/windowmanager.h"
+#include "joanna/systems/inputrecorder.h"
 #include "joanna/utils/logger.h"
 #include <SFML/Graphics.hpp>
 #include <functional>
@@ -11,7 +12,7 @@ class GameOver {
 
     void update(float dt);
     void render();
-    void handleInput(const sf::Event& event);
+    void handleInput(const InputSnapshot& input);
     void setOnRestart(std::function<void()> callback);
 
   private:
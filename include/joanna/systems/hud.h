@@ -0,0 +1,67 @@
+#pragma once
+
+#include "joanna/systems/textcache.h"
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Player;
+
+/**
+ * Part of the HUD bound to a few player values. The widget keeps its mesh
+ * and only rebuilds it when one of those values (or the layout) changes.
+ */
+class HudWidget {
+  public:
+    virtual ~HudWidget() = default;
+
+    // Rebuilds the mesh if the bound values changed, true if it did
+    bool sync(const Player& player, sf::Vector2f viewSize, bool relayout);
+
+    const std::vector<sf::Vertex>& getShapes() const {
+        return shapes;
+    }
+
+    const std::vector<sf::Vertex>& getIcons() const {
+        return icons;
+    }
+
+  protected:
+    // Reads the bound values, true if they differ from the last ones
+    virtual bool bind(const Player& player) = 0;
+    virtual void rebuild(sf::Vector2f viewSize) = 0;
+
+    std::vector<sf::Vertex> shapes; // untextured
+    std::vector<sf::Vertex> icons;  // from the tileset
+};
+
+/**
+ * Retained HUD (hearts and the ATK, DEF and EXP rows). The widget meshes are
+ * merged into one untextured and one tileset vertex array, so the HUD costs
+ * two draw calls plus the label batch however many segments it shows.
+ */
+class Hud {
+  public:
+    Hud();
+
+    void draw(
+        sf::RenderTarget& target, const Player& player, const sf::Font& font
+    );
+
+  private:
+    void rebuildLabels(const sf::Font& font);
+
+    std::vector<std::unique_ptr<HudWidget>> widgets;
+    std::vector<sf::Vertex> shapes;
+    std::vector<sf::Vertex> icons;
+    TextBatch labels;
+    const sf::Texture* tileset;
+    const sf::Font* labelFont = nullptr;
+    sf::Vector2f viewSize;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Logical input actions sampled once per tick. Held keys and key-press edges
+// share one bitmask so a tick fits in a single 32-bit word.
+enum class InputAction : std::uint8_t {
+    Left,
+    Right,
+    Up,
+    Down,
+    Sprint,
+    MapToggle,
+    Apply,
+    Pickup,
+    Talk,
+    Menu,
+    Slot1,
+    Slot2,
+    Slot3,
+    Slot4,
+    Slot5,
+    Slot6,
+    Slot7,
+    Slot8,
+    // edge-triggered: set only on the tick the key went down
+    CombatAttackPressed,
+    CombatDodgePressed,
+    // any key or mouse button, dismisses the game over screen
+    ContinuePressed
+};
+
+struct InputSnapshot {
+    std::uint32_t buttons = 0;
+    float dt = 0.f;
+
+    bool isDown(InputAction action) const {
+        return (buttons & bit(action)) != 0u;
+    }
+
+    void set(InputAction action, bool down) {
+        if (down) {
+            buttons |= bit(action);
+        } else {
+            buttons &= ~bit(action);
+        }
+    }
+
+  private:
+    static std::uint32_t bit(InputAction action) {
+        return 1u << static_cast<std::uint32_t>(action);
+    }
+};
+
+/**
+ * Records per-tick input snapshots together with the RNG seed of the run into
+ * a compact little-endian binary file, and plays them back bit-exactly.
+ * Ticks are appended to the file every FLUSH_TICKS ticks, so a crash loses at
+ * most the last few seconds.
+ *
+ * Layout: "JREC" | u16 version | u16 reserved | u64 seed | u32 tick count |
+ * tick count * (u32 buttons, f32 dt)
+ */
+class InputRecorder {
+  public:
+    enum class Mode { Off, Record, Replay };
+
+    InputRecorder() = default;
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    void startRecording(const std::filesystem::path& path, std::uint64_t seed);
+    bool startReplay(const std::filesystem::path& path);
+
+    // Writes the rest of a recording to disk and returns to Mode::Off.
+    void stop();
+
+    void record(const InputSnapshot& snapshot);
+    bool next(InputSnapshot& snapshot);
+
+    Mode getMode() const {
+        return mode;
+    }
+
+    std::uint64_t getSeed() const {
+        return seed;
+    }
+
+    std::size_t tickCount() const {
+        return flushedTicks + ticks.size();
+    }
+
+    bool isFinished() const {
+        return mode == Mode::Replay && cursor >= ticks.size();
+    }
+
+  private:
+    static constexpr std::uint16_t VERSION = 1;
+    static constexpr std::size_t FLUSH_TICKS = 300; // about 5 s at 60 fps
+
+    // Appends the buffered ticks and updates the tick count in the header
+    bool flush();
+
+    Mode mode = Mode::Off;
+    std::filesystem::path filePath;
+    std::ofstream file; // open while recording
+    std::uint64_t seed = 0;
+    std::vector<InputSnapshot> ticks; // replay: all, record: not yet written
+    std::size_t flushedTicks = 0;
+    std::size_t cursor = 0;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "joanna/entities/interactable.h"
+#include "joanna/world/proximityindex.h"
+#include "joanna/world/tilemanager.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Everything the player can interact with this tick, closest first
+struct InteractionTargets {
+    std::vector<Interactable*> interactables;
+    std::vector<uint32_t> pickups; // RenderObject ids
+    bool npcInRange = false;
+
+    Interactable* closest() const {
+        return interactables.empty() ? nullptr : interactables.front();
+    }
+};
+
+/**
+ * Proximity index over the interactables. Positions are pushed in with
+ * track() as entities move, refresh() then answers "what can the player
+ * interact with now" once per tick for input, rendering and dialogue hiding.
+ */
+class InteractionIndex {
+  public:
+    InteractionIndex() : index(Interactable::INTERACTION_DISTANCE) {}
+
+    void track(Interactable& interactable);
+    void forget(const Entity& entity);
+    void clear();
+
+    void refresh(sf::Vector2f playerPos, const TileManager& tileManager);
+
+    const InteractionTargets& getTargets() const {
+        return targets;
+    }
+
+  private:
+    ProximityIndex index;
+    std::unordered_map<uint32_t, Interactable*> tracked;
+    InteractionTargets targets;
+    std::vector<uint32_t> candidates;
+};
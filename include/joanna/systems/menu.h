@@ -5,6 +5,7 @@
 #include "joanna/core/windowmanager.h"
 
 #include <SFML/Graphics.hpp>
+#include <optional>
 
 class Game;
 
@@ -23,6 +24,15 @@ class Menu {
     std::vector<sf::Text> menuTexts;
     std::vector<sf::RectangleShape> menuBackgrounds;
     GameState stateToSave;
+    bool captureThumbnail = false; // grab the next world frame for the save
+    std::optional<sf::Vector2u> pendingResize; // last size seen this frame
+
+    // Details of the slot behind each option, empty for other options
+    struct SlotPreview {
+        std::string details;
+        std::optional<sf::Texture> thumbnail;
+    };
+    std::vector<std::optional<SlotPreview>> slotPreviews;
 
     int selectedIndex = 1; // Start at 1 to skip title
     bool isMenuOpen = true;
@@ -36,9 +46,12 @@ class Menu {
     void updateSelection(int direction); // -1 for up, 1 for down
     GameState createGameState(Player& player);
     void resetNewGame() const;
-    void loadEntityStates(const GameState& state);
+    void loadEntityStates();
     bool loadGameState(const std::string& choice, const std::string& slotNumStr);
     void executeSelection();
+    void showSlotOptions();
+    // Writes the snapshot to the slot in the background
+    void saveAsync(GameState state, const std::string& slotNumStr);
     void render(
         RenderEngine& render_engine, TileManager& tileManager,
         std::list<std::unique_ptr<Entity>>& entities,
@@ -46,12 +59,15 @@ class Menu {
     );
     void renderMenuOptions(sf::RenderTarget& target);
     void renderAboutOverlay(sf::RenderTarget& target) const;
+    void renderSlotPreview(sf::RenderTarget& target) const;
     void rebuildUI();
     sf::Vector2f getMouseWorldPos() const;
     void handleHover(const sf::Vector2f& mousePos);
     void resetToDefaultMenu();
 
   public:
+    static constexpr const char* AUTOSAVE_SLOT = "auto";
+
     Menu(
         WindowManager& windowManager, Controller& controller,
         TileManager& tileManager, AudioManager& audioManager,
@@ -65,6 +81,10 @@ class Menu {
     );
     void setOptions(const std::vector<std::string>& newOptions);
 
+    // Snapshots the game and writes it to the autosave slot in the
+    // background. Takes no thumbnail, so the frame does not stall.
+    void autosave();
+
     void setCanResume(bool enable) {
         canResume = enable;
         resetToDefaultMenu();
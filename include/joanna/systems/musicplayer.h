@@ -0,0 +1,108 @@
+#pragma once
+
+#include "joanna/systems/audiomanifest.h"
+
+#include <SFML/Audio/Music.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+enum class MusicId : std::uint8_t {
+    Overworld,
+    Underworld,
+    Beach,
+    Combat,
+    GameOver
+};
+
+/**
+ * Background music with crossfades. Streams are opened on a loader thread
+ * (prefetch() lets the game open a likely next track ahead of time) and kept
+ * open in a small cache. Rewinding a finished track (a seek in its file) and
+ * closing streams happen on the loader too, so switching tracks never
+ * touches the disk on the game thread. A track that is not ready yet starts
+ * as soon as it is; until then the current one keeps playing. Paths and
+ * volumes of the tracks come from the AudioManifest.
+ */
+class MusicPlayer {
+  public:
+    static constexpr std::size_t MAX_PREPARED = 3; // idle open streams
+    static constexpr std::size_t MUSIC_COUNT = 5;
+
+    explicit MusicPlayer(
+        const AudioManifest& manifest = AudioManifest::getInstance()
+    );
+    ~MusicPlayer();
+
+    MusicPlayer(const MusicPlayer&) = delete;
+    MusicPlayer& operator=(const MusicPlayer&) = delete;
+
+    // Crossfades to the track, restarting it unless it is still fading out
+    void play(MusicId id);
+
+    // Opens the track in the background so a later play() can start at once
+    void prefetch(MusicId id);
+
+    // Advances the fades and starts tracks that finished loading
+    void update(float dt);
+
+    void setVolume(float volume); // 0 - 100
+    void setCrossfadeDuration(float seconds);
+
+    void pause();
+    void resume();
+    void stop();
+
+    bool isPlaying() const;
+
+    // Manifest name of the track
+    static std::string_view getName(MusicId id);
+
+  private:
+    struct Track {
+        MusicId id;
+        std::unique_ptr<sf::Music> music;
+        float gain = 0.f; // fade position, 0 - 1
+    };
+
+    void startLoader();
+    void request(MusicId id);
+    void loaderLoop();
+    void collectLoaded();
+    void startRequested();
+    void park(Track track);   // keeps a rewound stream for reuse
+    void retire(Track track); // pauses, the loader rewinds and parks it
+    void applyVolume(Track& track) const;
+    bool isKnown(MusicId id) const;
+
+    const AudioManifest& manifest;
+    std::array<SoundId, MUSIC_COUNT> sounds{}; // by MusicId
+
+    std::optional<Track> current;
+    std::vector<Track> fadingOut;
+    std::vector<Track> prepared;
+    std::optional<MusicId> requested;
+    float volume = 30.f;
+    float crossfadeDuration = 1.5f;
+    bool paused = false;
+
+    // shared with the loader thread
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<MusicId> toLoad;
+    std::vector<MusicId> loading; // queued or being opened
+    std::vector<Track> loaded;   // opened or rewound, ready to park
+    std::vector<Track> toRewind;
+    std::vector<std::unique_ptr<sf::Music>> toClose;
+    bool stopping = false;
+    std::thread loader; // started on the first request
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "joanna/systems/audiomanifest.h"
+#include "joanna/systems/voicepool.h"
+
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+enum class SfxId : std::uint8_t {
+    Hit,
+    Footstep,
+    Dead,
+    Surprise,
+    Collect,
+    Damage,
+    Click,
+    Break,
+    Chest
+    // Sounds triggered from code, the rest is only named in the manifest
+};
+
+/**
+ * Sound effects played from a fixed pool of voices. Triggers are collected
+ * during the frame and started together in flush(): identical triggers of
+ * one frame play once, each sound has a cap on simultaneous instances, and
+ * a full pool steals the quietest-priority, oldest voice (see VoicePool).
+ * Positional sounds fade out with the distance to the listener.
+ *
+ * Clips and their limits come from the AudioManifest. Preloaded clips are
+ * decoded in the constructor. Lazy ones are decoded on a loader thread the
+ * first time they play; their triggers wait until the clip is ready, so the
+ * game thread never reads a clip from disk.
+ */
+class SfxPlayer {
+  public:
+    static constexpr std::size_t SFX_COUNT = 9;
+    static constexpr std::size_t VOICE_COUNT = 16;
+    static constexpr std::size_t MAX_TRIGGERS = TriggerBatch::CAPACITY;
+    static constexpr float MIN_DISTANCE = 120.f; // full volume inside
+    static constexpr float MAX_DISTANCE = 480.f; // silent outside
+
+    explicit SfxPlayer(
+        const AudioManifest& manifest = AudioManifest::getInstance()
+    );
+
+    ~SfxPlayer();
+
+    SfxPlayer(const SfxPlayer&) = delete;
+    SfxPlayer& operator=(const SfxPlayer&) = delete;
+
+    void trigger(SfxId id);
+    void trigger(SfxId id, sf::Vector2f position);
+    void trigger(SoundId id);
+    void trigger(SoundId id, sf::Vector2f position);
+
+    // Starts the triggers of this frame, call once per frame
+    void flush();
+
+    void setListener(sf::Vector2f position) {
+        listener = position;
+    }
+
+    void setVolume(float volume); // 0 - 100
+    void stopAll();
+
+    std::size_t getActiveVoices() const;
+
+    static float attenuation(float distance);
+
+    // Manifest name of a sound triggered from code
+    static std::string_view getName(SfxId id);
+
+  private:
+    using Decoded = std::pair<SoundId, std::unique_ptr<sf::SoundBuffer>>;
+
+    void addTrigger(SoundId id, float gain);
+    const sf::SoundBuffer* getBuffer(SoundId id);
+    void request(SoundId id);
+    void loaderLoop();
+    void collectDecoded();
+    bool isPlaying(std::size_t voice) const;
+
+    const AudioManifest& manifest;
+    std::array<SoundId, SFX_COUNT> builtins{};
+    std::vector<const sf::SoundBuffer*> buffers; // by SoundId, null if unused
+    std::vector<bool> failed;    // not loadable, not retried
+    std::vector<bool> requested; // lazy clips handed to the loader
+    // decoded lazy clips, the ResourceManager is not thread-safe
+    std::vector<std::unique_ptr<sf::SoundBuffer>> lazyBuffers;
+    // by voice, each built with its first buffer
+    std::array<std::optional<sf::Sound>, VOICE_COUNT> sounds;
+    VoicePool pool{ VOICE_COUNT };
+    TriggerBatch triggers;
+    TriggerBatch waiting; // for clips still being decoded
+    sf::Vector2f listener;
+    float volume = 100.f;
+
+    // shared with the loader thread
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<SoundId> toDecode;
+    std::vector<Decoded> decoded; // null if the clip failed to load
+    bool stopping = false;
+    std::thread loader; // started on the first request
+};
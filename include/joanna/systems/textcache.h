@@ -0,0 +1,126 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct TextStyle {
+    unsigned int size = 30;
+    float letterSpacing = 1.f;
+    float outlineThickness = 0.f;
+    bool bold = false;
+
+    bool operator==(const TextStyle&) const = default;
+};
+
+// Prebuilt glyph quads (in font page pixels) of one string, origin at (0, 0)
+struct TextLayout {
+    std::vector<sf::Vertex> fill;
+    std::vector<sf::Vertex> outline;
+    sf::FloatRect bounds; // matches sf::Text::getLocalBounds()
+};
+
+/**
+ * Layout cache for UI text keyed by (font, style, string). A string is laid
+ * out once and then reused every frame until it changes; layouts that have
+ * not been used for a while are dropped in endFrame().
+ */
+class TextCache {
+  public:
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    static TextCache& getInstance();
+
+    // The reference stays valid until the next endFrame()
+    const TextLayout&
+    get(const sf::Font& font, std::string_view text, const TextStyle& style);
+
+    void endFrame();
+
+    std::size_t size() const {
+        return entries.size();
+    }
+
+  private:
+    TextCache() = default;
+
+    struct Key {
+        const sf::Font* font;
+        TextStyle style;
+        std::string text;
+    };
+
+    struct KeyView {
+        const sf::Font* font;
+        TextStyle style;
+        std::string_view text;
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+        std::size_t operator()(const KeyView& key) const;
+        std::size_t operator()(const Key& key) const {
+            return (*this)(KeyView{ key.font, key.style, key.text });
+        }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return a.font == b.font && a.style == b.style &&
+                   std::string_view(a.text) == std::string_view(b.text);
+        }
+    };
+
+    struct Entry {
+        TextLayout layout;
+        std::uint64_t lastUsed = 0;
+    };
+
+    static TextLayout
+    build(const sf::Font& font, std::string_view text, const TextStyle& style);
+
+    static constexpr std::uint64_t MAX_IDLE_FRAMES = 120;
+
+    std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries;
+    std::uint64_t frame = 0;
+};
+
+/**
+ * Collects cached text and draws it with one draw call per font page
+ * (font and character size) instead of one or two per string.
+ */
+class TextBatch {
+  public:
+    void add(
+        const sf::Font& font, const TextStyle& style, const TextLayout& layout,
+        sf::Vector2f offset, sf::Color fillColor,
+        sf::Color outlineColor = sf::Color::Black
+    );
+
+    // Draws and clears the batch, the vertex storage is kept for reuse.
+    // With keep set the batch is retained and can be drawn again.
+    void draw(sf::RenderTarget& target, bool keep = false);
+
+    void clear();
+
+    bool empty() const;
+
+  private:
+    struct Page {
+        const sf::Texture* texture = nullptr;
+        std::vector<sf::Vertex> vertices;
+    };
+
+    std::vector<Page> pages;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Glyph advances and kerning of one font/size, looked up once and then read
+ * from tables. Used to measure and word-wrap UTF-8 text in a single pass
+ * without building sf::Text objects.
+ */
+class TextMetrics {
+  public:
+    TextMetrics(
+        const sf::Font& font, unsigned int size, float letterSpacing = 1.f
+    );
+
+    // Shared instance per (font, size, letter spacing)
+    static const TextMetrics&
+    get(const sf::Font& font, unsigned int size, float letterSpacing = 1.f);
+
+    float advance(char32_t c) const;
+    float kerning(char32_t first, char32_t second) const;
+
+    // Pen width of a single line
+    float measure(std::string_view utf8) const;
+
+    // Breaks at spaces so no line is wider than maxWidth (unless a single
+    // word is), keeps explicit newlines and collapses repeated spaces
+    std::string wrap(std::string_view utf8, float maxWidth) const;
+
+  private:
+    static constexpr std::size_t ASCII = 128;
+
+    const sf::Font* font;
+    unsigned int size;
+    float spacing;    // extra pen advance per glyph, as sf::Text computes it
+    float whitespace; // advance of ' ' incl. letter spacing
+
+    std::array<float, ASCII> asciiAdvance{};
+    mutable std::array<float, ASCII * ASCII> asciiKerning{};
+    mutable std::unordered_map<char32_t, float> otherAdvance;
+    mutable std::unordered_map<std::uint64_t, float> otherKerning;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "joanna/systems/audiomanifest.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * The triggers of one frame. The same sound triggered twice plays once, at
+ * the louder of the two gains.
+ */
+class TriggerBatch {
+  public:
+    static constexpr std::size_t CAPACITY = 32;
+
+    struct Trigger {
+        SoundId id;
+        float gain;
+    };
+
+    // false if the batch is full, the trigger is dropped
+    bool add(SoundId id, float gain);
+
+    void clear() {
+        count = 0;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    const Trigger* begin() const {
+        return triggers.data();
+    }
+
+    const Trigger* end() const {
+        return triggers.data() + count;
+    }
+
+  private:
+    std::array<Trigger, CAPACITY> triggers{};
+    std::size_t count = 0;
+};
+
+/**
+ * Decides which voice of a fixed pool a new sound plays on, without touching
+ * any audio objects: a sound at its instance cap restarts its oldest copy,
+ * otherwise a free voice is used, otherwise the voice with the lowest
+ * priority (the oldest among equals) is stolen if it does not outrank the
+ * new sound.
+ */
+class VoicePool {
+  public:
+    static constexpr std::size_t NO_VOICE = static_cast<std::size_t>(-1);
+
+    explicit VoicePool(std::size_t voiceCount);
+
+    // Voice to start the sound on, now busy, or NO_VOICE if it is dropped
+    std::size_t
+    allocate(SoundId id, std::uint8_t maxInstances, std::uint8_t priority);
+
+    // The voice finished playing
+    void release(std::size_t voice);
+    void releaseAll();
+
+    bool isBusy(std::size_t voice) const {
+        return voices.at(voice).busy;
+    }
+
+    SoundId getSound(std::size_t voice) const {
+        return voices.at(voice).id;
+    }
+
+    std::size_t size() const {
+        return voices.size();
+    }
+
+    std::size_t getBusyCount() const;
+
+  private:
+    struct Voice {
+        SoundId id = NO_SOUND;
+        std::uint8_t priority = 0;
+        std::uint64_t startedAt = 0;
+        bool busy = false;
+    };
+
+    std::vector<Voice> voices;
+    std::uint64_t startCounter = 0;
+};
@@ -7,6 +7,7 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 
 class Controller;
+class SaveWorker;
 class DebugUI {
   public:
     static void init(sf::RenderWindow& window);
@@ -14,7 +15,7 @@ class DebugUI {
     void update(
         float dt, sf::RenderWindow& window, Player& player,
         GameStatus& gameStatus, CombatSystem& combatSystem, Enemy& testEnemy,
-        Controller& controller
+        Controller& controller, SaveWorker& saveWorker
     ) const;
     void render(sf::RenderWindow& window) const;
     static void shutdown();
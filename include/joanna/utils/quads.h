@@ -0,0 +1,23 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/**
+ * Helpers for retained UI meshes drawn as sf::PrimitiveType::Triangles.
+ */
+
+// Two triangles, texRect in texture pixels (ignored without a texture)
+void appendQuad(
+    std::vector<sf::Vertex>& vertices, sf::FloatRect rect, sf::Color color,
+    sf::FloatRect texRect = {}
+);
+
+// Same look as a sf::RectangleShape: a positive thickness puts the outline
+// outside the rect, a negative one inside. A transparent fill is skipped.
+void appendOutlinedRect(
+    std::vector<sf::Vertex>& vertices, sf::FloatRect rect, sf::Color fill,
+    sf::Color outline, float thickness
+);
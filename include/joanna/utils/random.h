@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * Small, fast PCG32 (XSH-RR) generator. Satisfies UniformRandomBitGenerator,
+ * but prefer the helpers below: they are identical on every platform, unlike
+ * the std distributions.
+ */
+class Pcg32 {
+  public:
+    using result_type = std::uint32_t;
+
+    Pcg32() : Pcg32(0x853c49e6748fea9bULL) {}
+
+    explicit Pcg32(std::uint64_t seed, std::uint64_t sequence = 0) {
+        state = 0u;
+        inc = (sequence << 1u) | 1u;
+        (*this)();
+        state += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() {
+        return 0u;
+    }
+
+    static constexpr result_type max() {
+        return 0xFFFFFFFFu;
+    }
+
+    result_type operator()() {
+        const std::uint64_t old = state;
+        state = (old * 6364136223846793005ULL) + inc;
+        const auto xorshifted =
+            static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const auto rot = static_cast<std::uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((~rot + 1u) & 31u));
+    }
+
+    // unbiased integer in [0, bound)
+    std::uint32_t nextBelow(std::uint32_t bound) {
+        if (bound == 0u) {
+            return 0u;
+        }
+        const std::uint32_t threshold = (~bound + 1u) % bound;
+        for (;;) {
+            const std::uint32_t r = (*this)();
+            if (r >= threshold) {
+                return r % bound;
+            }
+        }
+    }
+
+    // integer in [lo, hi]
+    int range(int lo, int hi) {
+        if (hi <= lo) {
+            return lo;
+        }
+        return lo + static_cast<int>(
+                        nextBelow(static_cast<std::uint32_t>(hi - lo) + 1u)
+                    );
+    }
+
+    // float in [0, 1)
+    float nextFloat() {
+        return static_cast<float>((*this)() >> 8u) * (1.f / 16777216.f);
+    }
+
+    float range(float lo, float hi) {
+        return lo + ((hi - lo) * nextFloat());
+    }
+
+    bool chance(float probability) {
+        return nextFloat() < probability;
+    }
+
+  private:
+    std::uint64_t state;
+    std::uint64_t inc;
+};
+
+// Independent random streams, one per subsystem, so that e.g. extra loot rolls
+// never shift enemy behaviour of a replay.
+enum class RngStream : std::uint8_t { World, Loot, Spawns, EnemyAI, Combat, Count };
+
+/**
+ * Central seedable RNG service. The named streams belong to the game thread;
+ * code running on worker threads forks its own generator instead, which is
+ * deterministic for a given seed, stream and key.
+ */
+class Random {
+  public:
+    static void seed(std::uint64_t masterSeed);
+
+    static std::uint64_t getSeed() {
+        return masterSeed;
+    }
+
+    static Pcg32& stream(RngStream id) {
+        return streams.at(static_cast<std::size_t>(id));
+    }
+
+    // Derive an independent generator, e.g. one per entity id
+    static Pcg32 fork(RngStream id, std::uint64_t key);
+
+    // Fisher-Yates shuffle that yields the same order on every platform
+    template <typename It> static void shuffle(It first, It last, Pcg32& rng) {
+        const auto count = last - first;
+        for (auto i = count - 1; i > 0; --i) {
+            const auto j = static_cast<decltype(i)>(
+                rng.nextBelow(static_cast<std::uint32_t>(i + 1))
+            );
+            std::swap(first[i], first[j]);
+        }
+    }
+
+  private:
+    static std::uint64_t mix(std::uint64_t value);
+
+    static inline std::uint64_t masterSeed = 0;
+    static inline std::array<Pcg32, static_cast<std::size_t>(RngStream::Count)>
+        streams;
+};
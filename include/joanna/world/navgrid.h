@@ -0,0 +1,79 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * Navigation grid baked from the tile collision rects at map load.
+ *
+ * findPath() runs A* on an arena that is allocated once per bake and reused
+ * for every query (generation stamps instead of clearing). The flow field
+ * towards the player is shared by all enemies and only recomputed when the
+ * player enters another cell, so steering an enemy is a constant-time lookup.
+ */
+class NavGrid {
+  public:
+    static constexpr float CELL_SIZE = 8.f;
+
+    void bake(
+        const std::vector<sf::FloatRect>& collisions, sf::Vector2f worldSize
+    );
+
+    bool isBaked() const {
+        return width > 0 && height > 0;
+    }
+
+    sf::Vector2i toCell(sf::Vector2f position) const;
+    sf::Vector2f cellCenter(sf::Vector2i cell) const;
+    bool isWalkable(sf::Vector2i cell) const;
+
+    // true if every cell touched by the straight segment is walkable
+    bool isSegmentWalkable(sf::Vector2f from, sf::Vector2f to) const;
+
+    // A* search; writes cell-center waypoints (excluding the start) to path
+    bool findPath(
+        sf::Vector2f from, sf::Vector2f to, std::vector<sf::Vector2f>& path
+    );
+
+    // Recomputes the flow field only when target moved to another cell
+    void updateFlowField(sf::Vector2f target);
+
+    // Unit direction to follow from position, or {0, 0} if unreachable or
+    // already in the target cell
+    sf::Vector2f flowDirection(sf::Vector2f position) const;
+
+  private:
+    static constexpr std::uint16_t UNREACHED = 0xFFFF;
+    static constexpr int FLOW_RADIUS = 24; // cells around the target
+    static constexpr int MAX_EXPANSIONS = 4096;
+
+    int index(sf::Vector2i cell) const {
+        return (cell.y * width) + cell.x;
+    }
+
+    bool inBounds(sf::Vector2i cell) const {
+        return cell.x >= 0 && cell.y >= 0 && cell.x < width && cell.y < height;
+    }
+
+    bool canStep(sf::Vector2i from, sf::Vector2i delta) const;
+
+    int width = 0;
+    int height = 0;
+    std::vector<std::uint8_t> blocked;
+
+    // A* arena, sized once in bake()
+    std::vector<float> gScore;
+    std::vector<int> parent;
+    std::vector<std::uint32_t> visitedGen;
+    std::vector<std::uint32_t> closedGen;
+    std::vector<std::pair<float, int>> openHeap;
+    std::uint32_t generation = 0;
+
+    // flow field (integer path cost towards the target cell)
+    std::vector<std::uint16_t> flowCost;
+    std::vector<std::pair<int, int>> flowHeap;
+    sf::Vector2i flowTarget{ -1, -1 };
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Uniform grid over keyed points, bucketed by the query radius so a radius
+ * query only looks at the 3x3 cells around the center. move() is O(1) and
+ * only touches the buckets when the point crosses a cell border.
+ */
+class ProximityIndex {
+  public:
+    explicit ProximityIndex(float cellSize) : cellSize(cellSize) {}
+
+    // Inserts the key or updates its position
+    void move(std::uint32_t key, sf::Vector2f position);
+    void remove(std::uint32_t key);
+    void clear();
+
+    bool contains(std::uint32_t key) const {
+        return points.count(key) != 0u;
+    }
+
+    std::size_t size() const {
+        return points.size();
+    }
+
+    // Appends all keys within radius (<= cell size) of center to out
+    void query(
+        sf::Vector2f center, float radius, std::vector<std::uint32_t>& out
+    ) const;
+
+  private:
+    struct Point {
+        sf::Vector2f position;
+        std::int64_t cell;
+    };
+
+    std::int64_t cellOf(sf::Vector2f position) const;
+    static std::int64_t pack(std::int32_t x, std::int32_t y);
+    void unlink(std::int64_t cell, std::uint32_t key);
+
+    float cellSize;
+    std::unordered_map<std::uint32_t, Point> points;
+    std::unordered_map<std::int64_t, std::vector<std::uint32_t>> buckets;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Coarse areas of the world map. They pick the background music and name
+ * the location shown for a save slot.
+ */
+enum class Region : std::uint8_t { Overworld, Underworld, Beach };
+
+Region regionAt(sf::Vector2f position);
+
+std::string_view regionName(Region region);
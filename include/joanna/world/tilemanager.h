@@ -2,12 +2,15 @@
 
 #include "extern/tileson.hpp"
 #include "joanna/entities/player.h"
+#include "joanna/world/navgrid.h"
+#include "joanna/world/proximityindex.h"
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -38,6 +41,8 @@ struct RenderObject {
 
 class TileManager {
   public:
+    static constexpr float PICKUP_DISTANCE = 16.f;
+
     TileManager(sf::RenderWindow& window);
 
     bool loadMap(const std::string& path);
@@ -73,8 +78,21 @@ class TileManager {
         return m_overlayTiles;
     }
 
+    NavGrid& getNavGrid() {
+        return m_navGrid;
+    }
+
     sf::Sprite getTextureById(int id);
 
+    // Appends the ids of all objects within pickup distance of position
+    void findObjectsNear(
+        sf::Vector2f position, std::vector<uint32_t>& ids
+    ) const {
+        m_objectIndex.query(position, PICKUP_DISTANCE, ids);
+    }
+
+    [[nodiscard]] const RenderObject* getObjectById(uint32_t id) const;
+
     bool removeObjectById(int id);
 
     void loadObjectsFromSaveGame(const std::vector<ObjectState>& objects);
@@ -85,6 +103,7 @@ class TileManager {
     void randomlySelectItems(std::vector<tson::Object*> carrots, int count);
 
     void processLayer(const std::string& layerName);
+    void indexObjects();
     void loadTexture(const std::string& imagePath);
 
     void renderProgressBar(const std::string& message) const;
@@ -100,4 +119,7 @@ class TileManager {
     std::vector<TileRenderInfo> m_collidables;
     std::vector<TileRenderInfo> m_overlayTiles;
     std::vector<RenderObject> m_objects;
+    ProximityIndex m_objectIndex{ PICKUP_DISTANCE };
+    std::unordered_map<uint32_t, std::size_t> m_objectSlots; // id -> index
+    NavGrid m_navGrid;
 };
\ No newline at end of file
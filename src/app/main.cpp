@@ -1,8 +1,14 @@
 #include "joanna/core/game.h"
 
+#include "joanna/systems/inputrecorder.h"
 #include "joanna/utils/logger.h"
+#include "joanna/utils/random.h"
 
-int main() {
+#include <cstdlib>
+#include <random>
+#include <string>
+
+int main(int argc, char* argv[]) {
 
 #if LOGGING_ENABLED
     Logger::info("Logging enabled");
@@ -16,7 +22,42 @@ int main() {
     Logger::info("Infinite resources enabled");
 #endif
 
-    Game game;
+    // --record <file> / --replay <file> for reproducible benchmark runs,
+    // --no-effects draws without post-processing on low-end machines,
+    // --render-scale <0..1> / --virtual-height <lines> render the scene below
+    // window resolution, --dynamic-resolution lowers it when frames run long
+    InputRecorder inputRecorder;
+    std::uint64_t seed = std::random_device{}();
+    bool effects = true;
+    float renderScale = 1.f;
+    unsigned long virtualHeight = 0;
+    bool dynamicResolution = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            inputRecorder.startRecording(argv[++i], seed);
+        } else if (arg == "--replay" && i + 1 < argc) {
+            if (inputRecorder.startReplay(argv[++i])) {
+                seed = inputRecorder.getSeed();
+            }
+        } else if (arg == "--no-effects") {
+            effects = false;
+        } else if (arg == "--render-scale" && i + 1 < argc) {
+            renderScale = std::strtof(argv[++i], nullptr);
+        } else if (arg == "--virtual-height" && i + 1 < argc) {
+            virtualHeight = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--dynamic-resolution") {
+            dynamicResolution = true;
+        }
+    }
+    Random::seed(seed);
+
+    Game game(inputRecorder);
+    PostProcessing& postProc = game.getPostProcessing();
+    postProc.setEffectsEnabled(effects);
+    postProc.setRenderScale(renderScale);
+    postProc.setVirtualHeight(static_cast<unsigned int>(virtualHeight));
+    postProc.setDynamicResolution(dynamicResolution);
     game.run();
     return 0;
 }
@@ -11,20 +11,24 @@
 #include "joanna/systems/gameover.h"
 #include "joanna/systems/menu.h"
 #include "joanna/utils/dialogue_box.h"
+#include "joanna/world/region.h"
 #include "joanna/world/tilemanager.h"
 
 #include "SFML/Graphics/RenderWindow.hpp"
 #include "joanna/systems/audiomanager.h"
+#include "joanna/utils/random.h"
 #include "joanna/utils/resourcemanager.h"
 
 #include <SFML/System/Vector2.hpp>
 #include <fstream>
 #include <imgui-SFML.h>
+#include <optional>
 
-Game::Game()
+Game::Game(InputRecorder& inputRecorder)
     : windowManager(900, 900, "Joanna's Adventure"),
-      tileManager(windowManager.getWindow()), postProc(900, 900),
-      fontRenderer("assets/font/Pixellari.ttf") {
+      tileManager(windowManager.getWindow()), combatSystem(audioManager),
+      postProc(900, 900),
+      fontRenderer("assets/font/Pixellari.ttf"), inputRecorder(inputRecorder) {
     initialize();
 }
 
@@ -33,7 +37,8 @@ void Game::initialize() {
     controller =
         std::make_unique<Controller>(windowManager, audioManager, *this);
     std::ifstream file("assets/dialog/dialog.json");
-    NPC::jsonData = json::parse(file);
+    NPC::dialogues = DialogueTable::compile(json::parse(file));
+    NPC::navGrid = &tileManager.getNavGrid();
     sharedDialogueBox = std::make_shared<DialogueBox>(fontRenderer);
 
     gameOverScreen = std::make_unique<GameOver>(windowManager);
@@ -51,9 +56,16 @@ void Game::initialize() {
     menu = std::make_unique<Menu>(
         windowManager, *controller, tileManager, audioManager, entities, *this
     );
-    menu->show(
-        renderEngine, tileManager, entities, sharedDialogueBox, audioManager
-    );
+
+    // recordings always start from a fresh game and never enter the blocking
+    // menu, otherwise a replay could not reproduce them
+    if (inputRecorder.getMode() == InputRecorder::Mode::Off) {
+        menu->show(
+            renderEngine, tileManager, entities, sharedDialogueBox, audioManager
+        );
+    } else {
+        controller->setMenuEnabled(false);
+    }
 
     clock.restart();
 }
@@ -67,20 +79,35 @@ void Game::run() {
             dt = 0.0001f;
         }
 
-        update(dt);
-        render(dt);
+        if (!pollInput(dt)) {
+            Logger::info("Replay finished");
+            windowManager.getWindow().close();
+            break;
+        }
+
+        update(currentInput.dt);
+        render(currentInput.dt);
+        postProc.update(dt);
+        saveWorker.poll();
     }
 
+    inputRecorder.stop();
+    saveWorker.flush();
+
     if constexpr (IMGUI_ENABLED) {
         ImGui::SFML::Shutdown();
     }
     ResourceManager<sf::Font>::getInstance()->clear();
     ResourceManager<sf::Texture>::getInstance()->clear();
+    audioManager.stop_sfx(); // voices still point into the buffers
     ResourceManager<sf::SoundBuffer>::getInstance()->clear();
 }
 
 void Game::resetEntities() {
+    lastRegion.reset(); // a new or loaded game starts without an autosave
     entities.clear();
+    controller->getInteractions().clear();
+    aiScheduler.clear();
     entities.push_back(std::make_unique<NPC>(
         sf::Vector2f{ 220.f, 325.f }, "assets/player/npc/joe.png", "assets/buttons/interact_T.png",
         sharedDialogueBox, "Joe"
@@ -142,7 +169,9 @@ void Game::resetEntities() {
     );
 
     entities.push_back(
-        std::make_unique<Chest>(sf::Vector2f{ 652.f, 56.f }, "chest")
+        std::make_unique<Chest>(
+            sf::Vector2f{ 652.f, 56.f }, "chest", audioManager
+        )
     );
 
     for (auto& entity : entities) {
@@ -156,11 +185,9 @@ void Game::resetEntities() {
                                 otherNpc->getDialogId() == "Guard") {
                                 otherNpc->triggerMove(actionId);
                                 if (this->controller) {
-                                    this->controller->getPlayer()
-                                        .addInteraction(
-                                            otherNpc->getUniqueSpriteId() +
-                                            "_" + actionId
-                                        );
+                                    this->controller->getPlayer().setFlag(
+                                        otherNpc->flagFor(actionId)
+                                    );
                                 }
                             }
                         }
@@ -173,6 +200,8 @@ void Game::resetEntities() {
 
 void Game::handleInput() {
     sf::RenderWindow& window = windowManager.getWindow();
+    // a window drag sends many resizes per frame, only the last one counts
+    std::optional<sf::Vector2u> resizedTo;
     while (auto event = window.pollEvent()) {
         if constexpr (IMGUI_ENABLED) {
             windowManager.getDebugUI().processEvent(window, *event);
@@ -181,17 +210,21 @@ void Game::handleInput() {
             window.close();
         }
         if (const auto* resized = event->getIf<sf::Event::Resized>()) {
-            Game::resize(
-                { resized->size.x, resized->size.y }, 1.0f,
-                windowManager.getMainView(), window, postProc
-            );
-            windowManager.handleResizeEvent({ resized->size.x, resized->size.y }
-            );
+            resizedTo = resized->size;
         }
         if (gameStatus == GameStatus::Combat) {
-            combatSystem.handleInput(*event);
+            if (const auto* keyEvent = event->getIf<sf::Event::KeyPressed>()) {
+                if (keyEvent->code == sf::Keyboard::Key::A) {
+                    pendingPresses.set(InputAction::CombatAttackPressed, true);
+                } else if (keyEvent->code == sf::Keyboard::Key::D) {
+                    pendingPresses.set(InputAction::CombatDodgePressed, true);
+                }
+            }
         } else if (gameStatus == GameStatus::GameOver) {
-            gameOverScreen->handleInput(*event);
+            if (event->is<sf::Event::KeyPressed>() ||
+                event->is<sf::Event::MouseButtonPressed>()) {
+                pendingPresses.set(InputAction::ContinuePressed, true);
+            }
         }
         if (const auto* keyEvent = event->getIf<sf::Event::KeyPressed>()) {
             if (keyEvent->code == sf::Keyboard::Key::F1) {
@@ -199,18 +232,44 @@ void Game::handleInput() {
             }
         }
     }
+
+    if (resizedTo) {
+        Game::resize(
+            *resizedTo, 1.0f, windowManager.getMainView(), window, postProc
+        );
+        windowManager.handleResizeEvent(*resizedTo);
+    }
+}
+
+bool Game::pollInput(float dt) {
+    if (inputRecorder.getMode() == InputRecorder::Mode::Replay) {
+        pendingPresses = InputSnapshot();
+        return inputRecorder.next(currentInput);
+    }
+
+    currentInput = Controller::sampleKeyboard();
+    currentInput.buttons |= pendingPresses.buttons;
+    currentInput.dt = dt;
+    pendingPresses = InputSnapshot();
+    inputRecorder.record(currentInput);
+    return true;
 }
 
 void Game::update(float dt) {
+    if (gameStatus != GameStatus::GameOver) {
+        playTime += dt;
+    }
+
     // Music logic
     const auto getRegionMusic = [](const sf::Vector2f& pos) -> MusicId {
-        if (pos.x > 540.f) {
-            return MusicId::Underworld;
-        }
-        if (pos.y < 215.f) {
-            return MusicId::Beach;
+        switch (regionAt(pos)) {
+            case Region::Underworld:
+                return MusicId::Underworld;
+            case Region::Beach:
+                return MusicId::Beach;
+            default:
+                return MusicId::Overworld;
         }
-        return MusicId::Overworld;
     };
 
     MusicId targetMusic = MusicId::Overworld;
@@ -218,10 +277,19 @@ void Game::update(float dt) {
         targetMusic = MusicId::GameOver;
     } else if (gameStatus == GameStatus::Combat) {
         targetMusic = MusicId::Combat;
-    } else {
-        if (controller) {
-            targetMusic = getRegionMusic(controller->getPlayer().getPosition());
+        audioManager.prefetch_music(MusicId::GameOver);
+    } else if (controller) {
+        const sf::Vector2f pos = controller->getPlayer().getPosition();
+        targetMusic = getRegionMusic(pos);
+
+        // open the tracks behind nearby region borders ahead of time
+        constexpr float lookAhead = 96.f;
+        for (const sf::Vector2f offset :
+             { sf::Vector2f(lookAhead, 0.f), sf::Vector2f(-lookAhead, 0.f),
+               sf::Vector2f(0.f, lookAhead), sf::Vector2f(0.f, -lookAhead) }) {
+            audioManager.prefetch_music(getRegionMusic(pos + offset));
         }
+        audioManager.prefetch_music(MusicId::Combat);
     }
 
     if (targetMusic != currentMusicId) {
@@ -235,7 +303,7 @@ void Game::update(float dt) {
         if (controller && (enemyPtr != nullptr)) {
             windowManager.getDebugUI().update(
                 dt, window, controller->getPlayer(), gameStatus, combatSystem,
-                *enemyPtr, *controller
+                *enemyPtr, *controller, saveWorker
             );
         }
     }
@@ -247,12 +315,21 @@ void Game::update(float dt) {
     } else if (gameStatus == GameStatus::GameOver) {
         updateGameOver(dt);
     }
+
+    // after the state updates, so the sounds triggered there start this frame
+    if (controller) {
+        audioManager.set_listener_position(
+            controller->getPlayer().getPosition()
+        );
+    }
+    audioManager.update(dt);
 }
 
 void Game::updateOverworld(float dt) {
     if (!controller) {
         return;
     }
+    controller->setInput(currentInput);
 
     std::vector<sf::FloatRect> frameCollisions =
         tileManager.getCollisionRects();
@@ -276,19 +353,36 @@ void Game::updateOverworld(float dt) {
         clock.restart();
     }
 
+    // replays must not overwrite the player's autosave
+    const Region region = regionAt(controller->getPlayer().getPosition());
+    if (lastRegion && region != *lastRegion &&
+        inputRecorder.getMode() != InputRecorder::Mode::Replay) {
+        menu->autosave();
+    }
+    lastRegion = region;
+
+    // one shared flow field towards the player for all pursuing enemies
+    tileManager.getNavGrid().updateFlowField(
+        controller->getPlayer().getPosition()
+    );
+
+    const sf::View& view = windowManager.getMainView();
+    aiScheduler.beginFrame(
+        sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()),
+        controller->getPlayer().getPosition()
+    );
+
     // Goblin interaction
     if ((enemyPtr != nullptr) &&
-        enemyPtr->updateOverworld(dt, controller->getPlayer(), tileManager) ==
-            COMBAT_TRIGGERED) {
+        updateEnemy(*enemyPtr, dt) == COMBAT_TRIGGERED) {
         gameStatus = GameStatus::Combat;
         Logger::info("Goblin fight");
         combatSystem.startCombat(controller->getPlayer(), *enemyPtr);
     }
 
     // Skeleton Logic
-    if (controller->getPlayer().getInventory().hasItemByName("piratToken") &&
-        !controller->getPlayer().getInventory().hasItemByName("counterAttack"
-        )) {
+    if (controller->getPlayer().getInventory().hasItem(Items::PiratToken) &&
+        !controller->getPlayer().getInventory().hasItem(Items::CounterAttack)) {
         if (skeletonPtr == nullptr) {
             auto skeleton = std::make_unique<Enemy>(
                 sf::Vector2f{ 100.f, 110.f }, Enemy::EnemyType::Skeleton
@@ -297,16 +391,14 @@ void Game::updateOverworld(float dt) {
             entities.push_back(std::move(skeleton));
         }
 
-        if (skeletonPtr->updateOverworld(
-                dt, controller->getPlayer(), tileManager
-            ) == COMBAT_TRIGGERED) {
+        if (updateEnemy(*skeletonPtr, dt) == COMBAT_TRIGGERED) {
             gameStatus = GameStatus::Combat;
             combatSystem.startCombat(controller->getPlayer(), *skeletonPtr);
         }
 
         if (skeletonPtr->isDead()) {
             controller->getPlayer().getInventory().addItem(
-                Item("3055", "counterAttack")
+                Item(Items::CounterAttack)
             );
             Logger::info("Skeleton defeated. Counter attack added to inventory."
             );
@@ -322,7 +414,7 @@ void Game::updateOverworld(float dt) {
         controller->getPlayer().getPosition().x < 400.f) {
 
         if (randomSkeletonPtr == nullptr && skeletonSpawnTimer <= 0.f &&
-            (std::rand() % 3000 < 5)) {
+            Random::stream(RngStream::Spawns).nextBelow(3000) < 5) {
             auto randomSkeleton = std::make_unique<Enemy>(
                 sf::Vector2f{ controller->getPlayer().getPosition().x + 15.f,
                               controller->getPlayer().getPosition().y },
@@ -350,9 +442,7 @@ void Game::updateOverworld(float dt) {
         }
 
         if (randomSkeletonPtr != nullptr) {
-            if (randomSkeletonPtr->updateOverworld(
-                    dt, controller->getPlayer(), tileManager
-                ) == COMBAT_TRIGGERED) {
+            if (updateEnemy(*randomSkeletonPtr, dt) == COMBAT_TRIGGERED) {
                 gameStatus = GameStatus::Combat;
                 combatSystem.startCombat(
                     controller->getPlayer(), *randomSkeletonPtr
@@ -362,7 +452,17 @@ void Game::updateOverworld(float dt) {
     }
 }
 
+int Game::updateEnemy(Enemy& enemy, float dt) {
+    const AiTick tick =
+        aiScheduler.schedule(enemy.getId(), enemy.getPosition(), dt);
+    if (!tick.run) {
+        return COMBAT_IDLE;
+    }
+    return enemy.updateOverworld(tick, controller->getPlayer(), tileManager);
+}
+
 void Game::updateCombat(float dt) {
+    combatSystem.handleInput(currentInput);
     combatSystem.update(dt);
     if (combatSystem.battleFinished()) {
         combatSystem.endCombat();
@@ -375,25 +475,26 @@ void Game::updateCombat(float dt) {
         gameStatus = GameStatus::Overworld;
 
         if ((skeletonPtr != nullptr) && skeletonPtr->isDead() && controller &&
-            !controller->getPlayer().getInventory().hasItemByName(
-                "counterAttack"
+            !controller->getPlayer().getInventory().hasItem(
+                Items::CounterAttack
             )) {
             controller->getPlayer().getInventory().addItem(
-                Item("3055", "counterAttack")
+                Item(Items::CounterAttack)
             );
             Logger::info("Skeleton defeated. Counter attack added to inventory."
             );
         } else if (randomSkeletonPtr != nullptr &&
                    randomSkeletonPtr->isDead()) {
-            controller->getPlayer().getInventory().addItem(Item("628", "Bone"));
+            controller->getPlayer().getInventory().addItem(Item(Items::Bone));
         }
 
         entities.remove_if([&](const std::unique_ptr<Entity>& entity) {
             auto* enemy = dynamic_cast<Enemy*>(entity.get());
             if (enemy && enemy->isDead()) {
+                aiScheduler.forget(enemy->getId());
                 if (enemy == enemyPtr) {
                     Logger::info("Goblin dead");
-                    controller->getPlayer().addInteraction("goblinDead");
+                    controller->getPlayer().setFlag(Flags::GoblinDead);
                     enemyPtr = nullptr;
                 }
                 if (enemy == skeletonPtr) {
@@ -422,12 +523,14 @@ void Game::render(float dt) {
         windowManager.getDebugUI().render(windowManager.getWindow());
     }
     windowManager.getWindow().display();
+
+    // drop text layouts that were not drawn for a while
+    TextCache::getInstance().endFrame();
 }
 
 void Game::renderOverworld(float dt) {
     // Lazy resize check
-    if (postProc.getRenderTexture().getSize() !=
-        windowManager.getWindow().getSize()) {
+    if (postProc.getSize() != windowManager.getWindow().getSize()) {
         postProc.resize(
             windowManager.getWindow().getSize().x,
             windowManager.getWindow().getSize().y
@@ -443,6 +546,7 @@ void Game::renderOverworld(float dt) {
     );
 
     postProc.drawScene(
+        windowManager.getWindow(),
         [&](sf::RenderTarget& target, const sf::View& view) {
             if (controller->isMapOverviewActive()) {
                 sf::View& mapView = windowManager.getMapOverviewView();
@@ -453,7 +557,7 @@ void Game::renderOverworld(float dt) {
 
             renderEngine.render(
                 target, controller->getPlayer(), tileManager, entities,
-                sharedDialogueBox, dt
+                nullptr, controller->getInteractions().getTargets(), dt
             );
 
             // minimap
@@ -461,35 +565,32 @@ void Game::renderOverworld(float dt) {
                 target.setView(windowManager.getMiniMapView());
                 renderEngine.render(
                     target, controller->getPlayer(), tileManager, entities,
-                    sharedDialogueBox, dt
-                );
-
-                // ui
-                target.setView(windowManager.getUiView());
-                if (controller->renderInventory()) {
-                    controller->getPlayer().getInventory().displayInventory(
-                        target, tileManager
-                    );
-                }
-                controller->getPlayer().displayHealthBar(target, tileManager);
-                controller->getPlayer().getStats().draw(
-                    target, fontRenderer.getFont(),
-                    controller->getPlayer().getCurrentExp(),
-                    controller->getPlayer().getExpToNextLevel()
+                    nullptr, controller->getInteractions().getTargets(), dt
                 );
             }
         },
         nullptr
     );
+    sf::RenderWindow& window = windowManager.getWindow();
     sf::View fullView(sf::FloatRect(
         { 0.f, 0.f },
-        { static_cast<float>(windowManager.getWindow().getSize().x),
-          static_cast<float>(windowManager.getWindow().getSize().y) }
+        { static_cast<float>(window.getSize().x),
+          static_cast<float>(window.getSize().y) }
     ));
-    windowManager.getWindow().setView(fullView);
-    postProc.apply(
-        windowManager.getWindow(), clock.getElapsedTime().asSeconds()
-    );
+    window.setView(fullView);
+    postProc.apply(window, clock.getElapsedTime().asSeconds());
+
+    // ui at window resolution, its layout must not follow the scene size
+    if (sharedDialogueBox->isActive()) {
+        sharedDialogueBox->render(window);
+    }
+    if (!controller->isMapOverviewActive()) {
+        window.setView(windowManager.getUiView());
+        if (controller->renderInventory()) {
+            controller->getPlayer().getInventory().displayInventory(window);
+        }
+        hud.draw(window, controller->getPlayer(), fontRenderer.getFont());
+    }
 }
 
 void Game::resize(
@@ -522,8 +623,7 @@ void Game::resize(
 
 void Game::renderCombat() {
     // Lazy resize check
-    if (postProc.getRenderTexture().getSize() !=
-        windowManager.getWindow().getSize()) {
+    if (postProc.getSize() != windowManager.getWindow().getSize()) {
         postProc.resize(
             windowManager.getWindow().getSize().x,
             windowManager.getWindow().getSize().y
@@ -535,35 +635,32 @@ void Game::renderCombat() {
     combatView.setViewport(windowManager.getMainView().getViewport());
 
     postProc.drawScene(
+        windowManager.getWindow(),
         [&](sf::RenderTarget& target, const sf::View& view) {
             target.setView(combatView);
             combatSystem.render(target, tileManager, fontRenderer.getFont());
-
-            // ui
-            target.setView(windowManager.getUiView());
-            controller->getPlayer().displayHealthBar(target, tileManager);
-            controller->getPlayer().getStats().draw(
-                target, fontRenderer.getFont(),
-                controller->getPlayer().getCurrentExp(),
-                controller->getPlayer().getExpToNextLevel()
-            );
         },
         nullptr
     );
 
+    sf::RenderWindow& window = windowManager.getWindow();
     sf::View fullView(sf::FloatRect(
         { 0.f, 0.f },
-        { static_cast<float>(windowManager.getWindow().getSize().x),
-          static_cast<float>(windowManager.getWindow().getSize().y) }
+        { static_cast<float>(window.getSize().x),
+          static_cast<float>(window.getSize().y) }
     ));
-    windowManager.getWindow().setView(fullView);
-    postProc.apply(
-        windowManager.getWindow(), clock.getElapsedTime().asSeconds()
-    );
+    window.setView(fullView);
+    postProc.apply(window, clock.getElapsedTime().asSeconds());
+
+    // ui at window resolution
+    window.setView(windowManager.getUiView());
+    hud.draw(window, controller->getPlayer(), fontRenderer.getFont());
 }
 
 void Game::updateGameOver(float dt) {
     gameOverScreen->update(dt);
+    // from the snapshot, so replays restart at the same tick
+    gameOverScreen->handleInput(currentInput);
 }
 
 void Game::renderGameOver() {
@@ -577,8 +674,13 @@ void Game::returnToMenu() {
     // Reset player position to spawn
     controller->getPlayer().setPosition({ 150.f, 400.f });
     controller->getPlayerView().setCenter({ 150.f, 400.f });
-    menu->show(
-        renderEngine, tileManager, entities, sharedDialogueBox, audioManager
-    );
+    // the blocking menu reads the window directly, see initialize()
+    if (inputRecorder.getMode() == InputRecorder::Mode::Off) {
+        menu->show(
+            renderEngine, tileManager, entities, sharedDialogueBox, audioManager
+        );
+    } else {
+        controller->setMenuEnabled(false);
+    }
     clock.restart();
 }
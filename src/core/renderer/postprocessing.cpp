@@ -1,62 +1,412 @@
 #include "joanna/core/postprocessing.h"
 
+#include "joanna/utils/logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <type_traits>
+
+namespace {
+
+std::optional<PostProcessing::Uniform> parseUniform(const nlohmann::json& raw
+) {
+    if (raw.is_number()) {
+        return raw.get<float>();
+    }
+    if (raw.is_array() && raw.size() == 2) {
+        return sf::Vector2f(raw[0].get<float>(), raw[1].get<float>());
+    }
+    if (raw.is_array() && raw.size() == 4) {
+        return std::array<float, 4>{ raw[0].get<float>(), raw[1].get<float>(),
+                                     raw[2].get<float>(), raw[3].get<float>() };
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
 PostProcessing::PostProcessing(unsigned int width, unsigned int height)
-    : m_width(width), m_height(height),
-      m_sceneTexture(sf::Vector2u(width, height)),
-      m_sceneSprite(m_sceneTexture.getTexture()) {
-    if (!m_shader.loadFromFile(
-            "assets/shader/crt_shader.frag", sf::Shader::Type::Fragment
-        )) {
-        throw std::runtime_error("Failed to load CRT shader.");
-    }
-
-    m_shader.setUniform("scanline_color", sf::Glsl::Vec4(0.f, 0.f, 0.f, 1.f));
-    m_shader.setUniform("flicker_color", sf::Glsl::Vec4(0.f, 0.f, 0.f, 1.f));
-    m_shader.setUniform("scanlines_count", 10.f);
-    m_shader.setUniform("scanlines_intensity", 0.05f);
-    m_shader.setUniform("flicker_speed", 30.f);
-    m_shader.setUniform("flicker_intensity", 0.00f);
-    m_shader.setUniform("color_offset", 0.5f);
-    m_shader.setUniform(
-        "texture_size",
-        sf::Vector2f(static_cast<float>(width), static_cast<float>(height))
-    );
+    : m_width(width), m_height(height), m_renderSize(width, height) {
+    loadEffects(DEFAULT_EFFECTS);
+}
+
+void PostProcessing::loadEffects(const std::string& path) {
+    m_passes.clear();
+
+    std::ifstream file(path);
+    try {
+        const nlohmann::json data = nlohmann::json::parse(file);
+        for (const auto& raw : data.value("passes", nlohmann::json::array())) {
+            const std::string name = raw.at("name").get<std::string>();
+            if (!addPass(
+                    name, raw.at("shader").get<std::string>(),
+                    raw.value("scale", 1.f)
+                )) {
+                continue;
+            }
+            Pass& pass = m_passes.back();
+            pass.enabled = raw.value("enabled", true);
+            pass.animated = raw.value("animated", false);
+
+            const auto uniforms =
+                raw.value("uniforms", nlohmann::json::object());
+            for (const auto& [uniform, value] : uniforms.items()) {
+                if (const auto parsed = parseUniform(value)) {
+                    upload(pass, uniform, *parsed);
+                } else {
+                    Logger::warning("Bad value for {} of {}", uniform, name);
+                }
+            }
+        }
+    } catch (const nlohmann::json::exception& e) {
+        Logger::error("Failed to load effects {}: {}", path, e.what());
+    }
+
+    Logger::info("Loaded {} post-processing passes", m_passes.size());
+    updateTargets();
+}
+
+bool PostProcessing::addPass(
+    const std::string& name, const std::string& shaderPath, float scale
+) {
+    auto shader = std::make_unique<sf::Shader>();
+    if (!shader->loadFromFile(shaderPath, sf::Shader::Type::Fragment)) {
+        Logger::error("Failed to load shader {} of pass {}", shaderPath, name);
+        return false;
+    }
+    // the input is always the texture of the sprite being drawn
+    shader->setUniform("texture", sf::Shader::CurrentTexture);
+
+    Pass pass;
+    pass.name = name;
+    pass.shader = std::move(shader);
+    pass.scale = std::clamp(scale, 0.1f, 1.f);
+    m_passes.push_back(std::move(pass));
+    updateTargets();
+    return true;
+}
+
+void PostProcessing::setPassEnabled(std::string_view name, bool enabled) {
+    if (Pass* pass = findPass(name)) {
+        pass->enabled = enabled;
+        updateTargets();
+    }
+}
+
+bool PostProcessing::isPassEnabled(std::string_view name) const {
+    const Pass* pass = findPass(name);
+    return pass != nullptr && pass->enabled;
+}
+
+void PostProcessing::setPassAnimated(std::string_view name, bool animated) {
+    if (Pass* pass = findPass(name)) {
+        pass->animated = animated;
+    }
+}
+
+void PostProcessing::setEffectsEnabled(bool enabled) {
+    m_effectsEnabled = enabled;
+    updateTargets();
+}
+
+bool PostProcessing::isActive() const {
+    return hasEnabledPass() || m_renderSize != getSize();
+}
+
+void PostProcessing::setRenderScale(float scale) {
+    m_renderScale = std::clamp(scale, 0.1f, 1.f);
+    updateRenderSize();
+}
+
+void PostProcessing::setVirtualHeight(unsigned int height) {
+    m_virtualHeight = height;
+    updateRenderSize();
+}
+
+void PostProcessing::setDynamicResolution(bool enabled, float frameBudget) {
+    m_dynamic = enabled;
+    m_frameBudget = frameBudget;
+    m_frameTime = 0.f;
+    m_adjustTimer = 0.f;
+    if (!enabled && m_dynamicScale != 1.f) {
+        m_dynamicScale = 1.f;
+        updateRenderSize();
+    }
+}
+
+void PostProcessing::update(float dt) {
+    if (m_resizePending) {
+        m_resizeTimer += dt;
+        if (m_resizeTimer < RESIZE_SETTLE) {
+            return; // frame times are noisy while dragging
+        }
+        m_resizePending = false;
+        updateRenderSize();
+    }
+
+    if (!m_dynamic) {
+        return;
+    }
+    m_frameTime += (dt - m_frameTime) * 0.1f;
+    m_adjustTimer += dt;
+    if (m_adjustTimer < ADJUST_INTERVAL) {
+        return;
+    }
+
+    float scale = m_dynamicScale;
+    if (m_frameTime > m_frameBudget) {
+        scale = std::max(MIN_DYNAMIC_SCALE, scale - DYNAMIC_STEP);
+    } else if (m_frameTime < m_frameBudget * 0.75f) {
+        // well below budget, the gap keeps it from flipping back and forth
+        scale = std::min(1.f, scale + DYNAMIC_STEP);
+    }
+    if (scale != m_dynamicScale) {
+        m_dynamicScale = scale;
+        m_adjustTimer = 0.f;
+        updateRenderSize();
+    }
+}
+
+void PostProcessing::setUniform(
+    std::string_view pass, const std::string& name, const Uniform& value
+) {
+    if (Pass* found = findPass(pass)) {
+        upload(*found, name, value);
+    } else {
+        Logger::warning("No post-processing pass {}", pass);
+    }
 }
 
 void PostProcessing::drawScene(
-    const std::function<void(sf::RenderTarget&, const sf::View&)>& drawFunc,
+    sf::RenderTarget& output, const DrawFunc& drawFunc,
     const sf::View* customView
 ) {
-    m_sceneTexture.clear(sf::Color::Black);
-
-    sf::View oldView = m_sceneTexture.getView();
+    // fast path, no pass runs so skip the intermediate texture
+    sf::RenderTarget& target =
+        m_targets[0] ? static_cast<sf::RenderTarget&>(*m_targets[0]) : output;
+    if (m_targets[0]) {
+        m_targets[0]->clear(sf::Color::Black);
+    }
 
+    const sf::View oldView = target.getView();
     if (customView != nullptr) {
-        m_sceneTexture.setView(*customView);
-    } else {
-        m_sceneTexture.setView(oldView);
+        target.setView(*customView);
     }
 
-    drawFunc(m_sceneTexture, m_sceneTexture.getView());
+    drawFunc(target, target.getView());
 
-    m_sceneTexture.setView(oldView);
-    m_sceneTexture.display();
+    target.setView(oldView);
+    if (m_targets[0]) {
+        m_targets[0]->display();
+    }
 }
 
 void PostProcessing::apply(sf::RenderTarget& target, float time) {
-    m_shader.setUniform("texture", m_sceneTexture.getTexture());
-    m_shader.setUniform("time", time);
-    target.draw(m_sceneSprite, &m_shader);
+    if (!m_targets[0]) {
+        return; // the scene is already in the target
+    }
+
+    const sf::Vector2f full(m_renderSize);
+
+    Pass* last = nullptr;
+    for (Pass& pass : m_passes) {
+        if (pass.enabled && m_effectsEnabled) {
+            last = &pass;
+        }
+    }
+
+    std::size_t source = 0;
+    sf::Vector2f sourceSize = full;
+    for (Pass& pass : m_passes) {
+        if (!pass.enabled || !m_effectsEnabled) {
+            continue;
+        }
+        if (pass.animated) {
+            pass.shader->setUniform("time", time);
+        }
+        // the input fills the top-left part of its texture, cached so these
+        // are only uploaded when the sizes change
+        upload(pass, "texture_size", sourceSize);
+        upload(
+            pass, "uv_scale",
+            sf::Vector2f(sourceSize.x / full.x, sourceSize.y / full.y)
+        );
+
+        sf::Sprite sprite(m_targets[source]->getTexture());
+        sprite.setTextureRect(sf::IntRect(
+            { 0, 0 }, { static_cast<int>(sourceSize.x),
+                        static_cast<int>(sourceSize.y) }
+        ));
+
+        if (&pass == last && pass.scale >= 1.f) {
+            // upscales to the window as it goes
+            sprite.setScale(
+                { m_outputScale.x * full.x / sourceSize.x,
+                  m_outputScale.y * full.y / sourceSize.y }
+            );
+            target.draw(sprite, pass.shader.get());
+            return;
+        }
+
+        // write the top-left part of the other texture at the pass scale
+        const std::size_t destination = 1 - source;
+        const sf::Vector2f size(
+            std::max(1.f, std::round(full.x * pass.scale)),
+            std::max(1.f, std::round(full.y * pass.scale))
+        );
+        sprite.setScale({ size.x / sourceSize.x, size.y / sourceSize.y });
+        m_targets[destination]->clear(sf::Color::Black);
+        m_targets[destination]->draw(sprite, pass.shader.get());
+        m_targets[destination]->display();
+
+        source = destination;
+        sourceSize = size;
+    }
+
+    // no pass wrote the window, upscale the last output (nearest filtering)
+    sf::Sprite sprite(m_targets[source]->getTexture());
+    sprite.setTextureRect(sf::IntRect(
+        { 0, 0 },
+        { static_cast<int>(sourceSize.x), static_cast<int>(sourceSize.y) }
+    ));
+    sprite.setScale(
+        { m_outputScale.x * full.x / sourceSize.x,
+          m_outputScale.y * full.y / sourceSize.y }
+    );
+    target.draw(sprite);
 }
 
 void PostProcessing::resize(unsigned int width, unsigned int height) {
+    if (width == m_width && height == m_height) {
+        return;
+    }
     m_width = width;
     m_height = height;
 
-    m_sceneTexture = sf::RenderTexture({ width, height });
-    m_sceneSprite.setTexture(m_sceneTexture.getTexture(), true);
-    m_shader.setUniform(
-        "texture_size",
-        sf::Vector2f(static_cast<float>(width), static_cast<float>(height))
+    // stretch the current textures until the size settles
+    m_outputScale = {
+        static_cast<float>(std::max(1u, width)) / m_renderSize.x,
+        static_cast<float>(std::max(1u, height)) / m_renderSize.y
+    };
+    m_resizePending = true;
+    m_resizeTimer = 0.f;
+}
+
+PostProcessing::Pass* PostProcessing::findPass(std::string_view name) {
+    const auto it =
+        std::find_if(m_passes.begin(), m_passes.end(), [&](const Pass& pass) {
+            return pass.name == name;
+        });
+    return it != m_passes.end() ? &*it : nullptr;
+}
+
+const PostProcessing::Pass* PostProcessing::findPass(std::string_view name
+) const {
+    return const_cast<PostProcessing*>(this)->findPass(name);
+}
+
+void PostProcessing::upload(
+    Pass& pass, const std::string& name, const Uniform& value
+) {
+    auto cached = std::find_if(
+        pass.uniforms.begin(), pass.uniforms.end(),
+        [&](const auto& uniform) { return uniform.first == name; }
+    );
+    if (cached != pass.uniforms.end()) {
+        if (cached->second == value) {
+            return; // unchanged, skip the upload
+        }
+        cached->second = value;
+    } else {
+        pass.uniforms.emplace_back(name, value);
+    }
+
+    std::visit(
+        [&](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, float>) {
+                pass.shader->setUniform(name, v);
+            } else if constexpr (std::is_same_v<T, sf::Vector2f>) {
+                pass.shader->setUniform(name, sf::Glsl::Vec2(v));
+            } else {
+                pass.shader->setUniform(
+                    name, sf::Glsl::Vec4(v[0], v[1], v[2], v[3])
+                );
+            }
+        },
+        value
     );
 }
+
+void PostProcessing::updateTargets() {
+    if (!isActive()) {
+        // fast path, release the textures
+        m_targets[0].reset();
+        m_targets[1].reset();
+        return;
+    }
+
+    // the second texture is only needed when a pass does not write the output
+    std::size_t enabled = 0;
+    float lastScale = 1.f;
+    for (const Pass& pass : m_passes) {
+        if (pass.enabled && m_effectsEnabled) {
+            ++enabled;
+            lastScale = pass.scale;
+        }
+    }
+    const std::size_t needed = enabled > 1 || lastScale < 1.f ? 2 : 1;
+
+    for (std::size_t i = 0; i < m_targets.size(); ++i) {
+        if (i >= needed) {
+            m_targets[i].reset();
+        } else if (!m_targets[i]) {
+            m_targets[i].emplace(m_renderSize);
+        }
+    }
+}
+
+void PostProcessing::updateRenderSize() {
+    const unsigned int width = std::max(1u, m_width);
+    const unsigned int height = std::max(1u, m_height);
+
+    float scale = m_renderScale;
+    unsigned int factor = 0;
+    if (m_virtualHeight > 0) {
+        factor = std::max(1u, height / m_virtualHeight);
+        scale = 1.f / static_cast<float>(factor);
+    }
+    scale *= m_dynamicScale;
+
+    sf::Vector2u size;
+    if (factor > 0 && m_dynamicScale >= 1.f) {
+        // exact whole factor, round up and let the window clip the rest
+        size = { (width + factor - 1) / factor,
+                 (height + factor - 1) / factor };
+        m_outputScale = { static_cast<float>(factor),
+                          static_cast<float>(factor) };
+    } else {
+        size = {
+            std::max(1u, static_cast<unsigned int>(std::lround(width * scale))),
+            std::max(1u, static_cast<unsigned int>(std::lround(height * scale)))
+        };
+        m_outputScale = { static_cast<float>(width) / size.x,
+                          static_cast<float>(height) / size.y };
+    }
+
+    if (size != m_renderSize) {
+        m_renderSize = size;
+        m_targets[0].reset();
+        m_targets[1].reset();
+    }
+    updateTargets();
+}
+
+bool PostProcessing::hasEnabledPass() const {
+    return m_effectsEnabled &&
+           std::any_of(m_passes.begin(), m_passes.end(), [](const Pass& pass) {
+               return pass.enabled;
+           });
+}
@@ -7,7 +7,8 @@ RenderEngine::RenderEngine() = default;
 void RenderEngine::render(
     sf::RenderTarget& target, Player& player, TileManager& tileManager,
     std::list<std::unique_ptr<Entity>>& entities,
-    const std::shared_ptr<DialogueBox>& dialogueBox, float dt
+    const std::shared_ptr<DialogueBox>& dialogueBox,
+    const InteractionTargets& interactions, float dt
 ) {
     const auto& m_textures = tileManager.getGroundTextures();
     const auto& m_tiles = tileManager.getTiles();
@@ -92,20 +93,16 @@ void RenderEngine::render(
         player.draw(target);
     }
 
-    for (auto& entity : entities) {
-        if (auto* interactable = dynamic_cast<Interactable*>(entity.get())) {
-            if (dynamic_cast<Stone*>(entity.get()) != nullptr &&
-                !player.getInventory().hasItemByName("pickaxe")) {
-                continue;
-            }
-            if (interactable->canPlayerInteract(player.getPosition())) {
-                if (dynamic_cast<Chest*>(entity.get()) != nullptr &&
-                    dynamic_cast<Chest*>(entity.get())->isChestOpen()) {
-                    continue;
-                }
-                interactable->renderButton(target);
-            }
+    for (Interactable* interactable : interactions.interactables) {
+        if (dynamic_cast<Stone*>(interactable) != nullptr &&
+            !player.getInventory().hasItem(Items::Pickaxe)) {
+            continue;
         }
+        if (auto* chest = dynamic_cast<Chest*>(interactable);
+            chest != nullptr && chest->isChestOpen()) {
+            continue;
+        }
+        interactable->renderButton(target);
     }
 
     // draw overlay tiles
@@ -113,7 +110,7 @@ void RenderEngine::render(
         drawTile(tile);
     }
 
-    if (dialogueBox->isActive()) {
+    if (dialogueBox && dialogueBox->isActive()) {
         dialogueBox->render(target);
     }
 
@@ -135,18 +132,19 @@ void RenderEngine::render(
             offset += dir * 0.5f;
         }
         target.draw(i);
+    }
 
-        auto playerPos = player.getPosition();
-        auto itemPos = item.position;
-        float dx = playerPos.x - static_cast<float>(itemPos.x);
-        float dy = playerPos.y - static_cast<float>(itemPos.y);
-        if (dx * dx + dy * dy <= 16.f * 16.f) {
-            sf::Sprite indicator = tileManager.getTextureById(2919);
-            indicator.setPosition(
-                sf::Vector2f({ static_cast<float>(item.position.x),
-                               static_cast<float>(item.position.y) - 10.f })
-            );
-            target.draw(indicator);
+    for (const uint32_t id : interactions.pickups) {
+        // may have been picked up earlier this tick
+        const RenderObject* item = tileManager.getObjectById(id);
+        if (item == nullptr) {
+            continue;
         }
+        sf::Sprite indicator = tileManager.getTextureById(2919);
+        indicator.setPosition(
+            sf::Vector2f({ static_cast<float>(item->position.x),
+                           static_cast<float>(item->position.y) - 10.f })
+        );
+        target.draw(indicator);
     }
 }
\ No newline at end of file
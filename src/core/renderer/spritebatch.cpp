@@ -0,0 +1,63 @@
+#include "joanna/core/spritebatch.h"
+
+#include "joanna/utils/quads.h"
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <cmath>
+
+void SpriteBatch::useTexture(const sf::Texture& texture) {
+    if (runs.empty() || runs.back().texture != &texture) {
+        runs.push_back({ &texture, vertices.size() });
+    }
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite) {
+    useTexture(sprite.getTexture());
+
+    // same corners as sf::Sprite, a negative texture rect size flips it
+    const sf::FloatRect texRect(sprite.getTextureRect());
+    const sf::Vector2f size(std::abs(texRect.size.x), std::abs(texRect.size.y));
+    const sf::Transform transform = sprite.getTransform();
+    const sf::Color color = sprite.getColor();
+
+    const sf::Vector2f ta = texRect.position;
+    const sf::Vector2f tb = texRect.position + texRect.size;
+    const sf::Vertex topLeft{ transform.transformPoint({ 0.f, 0.f }), color,
+                              ta };
+    const sf::Vertex topRight{ transform.transformPoint({ size.x, 0.f }),
+                               color,
+                               { tb.x, ta.y } };
+    const sf::Vertex bottomLeft{ transform.transformPoint({ 0.f, size.y }),
+                                 color,
+                                 { ta.x, tb.y } };
+    const sf::Vertex bottomRight{ transform.transformPoint(size), color, tb };
+    vertices.insert(
+        vertices.end(),
+        { topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight }
+    );
+    runs.back().end = vertices.size();
+}
+
+void SpriteBatch::add(
+    const sf::Texture& texture, const sf::FloatRect rect,
+    const sf::IntRect texRect, const sf::Color color
+) {
+    useTexture(texture);
+    appendQuad(vertices, rect, color, sf::FloatRect(texRect));
+    runs.back().end = vertices.size();
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target) {
+    std::size_t begin = 0;
+    for (const Run& run : runs) {
+        sf::RenderStates states;
+        states.texture = run.texture;
+        target.draw(
+            vertices.data() + begin, run.end - begin,
+            sf::PrimitiveType::Triangles, states
+        );
+        begin = run.end;
+    }
+    vertices.clear();
+    runs.clear();
+}
@@ -0,0 +1,385 @@
+#include "joanna/core/savecodec.h"
+
+#include "joanna/utils/logger.h"
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+using json = nlohmann::json;
+
+namespace {
+constexpr std::array<char, 4> MAGIC = { 'J', 'S', 'A', 'V' };
+constexpr std::array<char, 4> INDEX_MAGIC = { 'J', 'S', 'L', 'I' };
+constexpr std::uint16_t INDEX_VERSION = 1;
+constexpr std::size_t HEADER_SIZE = 4 + 2 + 2 + 4 + 4;
+
+template <typename T> void putLE(std::vector<char>& out, T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+template <typename T> T getLE(const char* in) {
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<unsigned char>(in[i])) << (8 * i);
+    }
+    return value;
+}
+
+void putI32(std::vector<char>& out, const int value) {
+    putLE<std::uint32_t>(out, static_cast<std::uint32_t>(value));
+}
+
+void putF32(std::vector<char>& out, const float value) {
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(float));
+    putLE<std::uint32_t>(out, bits);
+}
+
+void putString(std::vector<char>& out, const std::string& text) {
+    putLE<std::uint16_t>(out, static_cast<std::uint16_t>(text.size()));
+    out.insert(out.end(), text.begin(), text.end());
+}
+
+void putBytes(std::vector<char>& out, const std::vector<std::uint8_t>& bytes) {
+    putLE<std::uint32_t>(out, static_cast<std::uint32_t>(bytes.size()));
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+std::vector<char> wrapPayload(
+    const std::array<char, 4>& magic, const std::uint16_t version,
+    const std::vector<char>& payload
+) {
+    std::vector<char> data(magic.begin(), magic.end());
+    data.reserve(HEADER_SIZE + payload.size());
+    putLE<std::uint16_t>(data, version);
+    putLE<std::uint16_t>(data, 0); // reserved
+    putLE<std::uint32_t>(data, static_cast<std::uint32_t>(payload.size()));
+    putLE<std::uint32_t>(
+        data, SaveCodec::crc32(payload.data(), payload.size())
+    );
+    data.insert(data.end(), payload.begin(), payload.end());
+    return data;
+}
+
+// Checks magic, size and CRC, returns the version or 0 if the data is bad
+std::uint16_t checkHeader(
+    const std::vector<char>& data, const std::array<char, 4>& magic
+) {
+    if (data.size() < HEADER_SIZE ||
+        std::memcmp(data.data(), magic.data(), magic.size()) != 0) {
+        Logger::error("Invalid save file header");
+        return 0;
+    }
+    const auto payloadSize = getLE<std::uint32_t>(data.data() + 8);
+    const char* payload = data.data() + HEADER_SIZE;
+    if (data.size() - HEADER_SIZE < payloadSize ||
+        SaveCodec::crc32(payload, payloadSize) !=
+            getLE<std::uint32_t>(data.data() + 12)) {
+        Logger::error("Save file is truncated or corrupted");
+        return 0;
+    }
+    return getLE<std::uint16_t>(data.data() + 4);
+}
+
+// Strings are written once, fields refer to them by index
+class StringTable {
+  public:
+    std::uint32_t add(const std::string& text) {
+        const auto [it, inserted] = indices.try_emplace(
+            text, static_cast<std::uint32_t>(strings.size())
+        );
+        if (inserted) {
+            strings.push_back(&it->first);
+        }
+        return it->second;
+    }
+
+    void write(std::vector<char>& out) const {
+        putLE<std::uint32_t>(out, static_cast<std::uint32_t>(strings.size()));
+        for (const std::string* text : strings) {
+            putString(out, *text);
+        }
+    }
+
+  private:
+    std::unordered_map<std::string, std::uint32_t> indices;
+    std::vector<const std::string*> strings;
+};
+
+// Bounds-checked cursor, a read past the end clears ok and yields zeros
+class Reader {
+  public:
+    Reader(const char* data, std::size_t size) : data(data), size(size) {}
+
+    template <typename T> T get() {
+        if (!ok || size - pos < sizeof(T)) {
+            ok = false;
+            return T{};
+        }
+        const T value = getLE<T>(data + pos);
+        pos += sizeof(T);
+        return value;
+    }
+
+    int getI32() {
+        return static_cast<int>(get<std::uint32_t>());
+    }
+
+    float getF32() {
+        const auto bits = get<std::uint32_t>();
+        float value = 0.f;
+        std::memcpy(&value, &bits, sizeof(float));
+        return value;
+    }
+
+    std::string getString() {
+        const auto length = get<std::uint16_t>();
+        if (!ok || size - pos < length) {
+            ok = false;
+            return {};
+        }
+        std::string text(data + pos, length);
+        pos += length;
+        return text;
+    }
+
+    // u32 length followed by raw bytes
+    std::vector<std::uint8_t> getBytes() {
+        const auto length = getCount(1);
+        if (!ok) {
+            return {};
+        }
+        const auto* begin = reinterpret_cast<const std::uint8_t*>(data + pos);
+        pos += length;
+        return { begin, begin + length };
+    }
+
+    // count of elements of at least elementSize bytes, guards the reserve
+    std::uint32_t getCount(std::size_t elementSize) {
+        const auto count = get<std::uint32_t>();
+        if (ok && count > (size - pos) / elementSize) {
+            ok = false;
+            return 0;
+        }
+        return count;
+    }
+
+    bool ok = true;
+
+  private:
+    const char* data;
+    std::size_t size;
+    std::size_t pos = 0;
+};
+} // namespace
+
+std::uint32_t SaveCodec::crc32(const char* data, const std::size_t size) {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> result{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1u) != 0 ? 0xEDB88320u ^ (c >> 1u) : c >> 1u;
+            }
+            result.at(i) = c;
+        }
+        return result;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = table.at((crc ^ static_cast<unsigned char>(data[i])) & 0xFFu) ^
+              (crc >> 8u);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+std::vector<char> SaveCodec::encodeBinary(const GameState& state) {
+    StringTable strings;
+    std::vector<char> body;
+    body.reserve(
+        64 + (state.inventory.items.size() * 8) + (state.map.items.size() * 16)
+    );
+
+    const PlayerState& player = state.player;
+    putI32(body, player.health);
+    putF32(body, player.x);
+    putF32(body, player.y);
+    putI32(body, player.attack);
+    putI32(body, player.defense);
+    putI32(body, player.level);
+    putI32(body, player.currentExp);
+    putI32(body, player.expToNextLevel);
+    putLE<std::uint32_t>(
+        body, static_cast<std::uint32_t>(player.visitedInteractions.size())
+    );
+    for (const auto& key : player.visitedInteractions) {
+        putLE<std::uint32_t>(body, strings.add(key));
+    }
+
+    putLE<std::uint32_t>(
+        body, static_cast<std::uint32_t>(state.inventory.items.size())
+    );
+    for (const auto& item : state.inventory.items) {
+        putLE<std::uint32_t>(body, strings.add(item.id));
+        putLE<std::uint32_t>(body, item.quantity);
+    }
+
+    putLE<std::uint32_t>(
+        body, static_cast<std::uint32_t>(state.map.items.size())
+    );
+    for (const auto& object : state.map.items) {
+        putLE<std::uint32_t>(body, object.id);
+        putLE<std::uint32_t>(body, object.gid);
+        putI32(body, object.x);
+        putI32(body, object.y);
+    }
+    putLE<std::uint64_t>(body, state.rngSeed);
+    putLE<std::uint32_t>(body, strings.add(state.region));
+    putLE<std::uint32_t>(body, state.playTime);
+
+    // payload = string table followed by the fields
+    std::vector<char> payload;
+    payload.reserve(body.size() + 256);
+    strings.write(payload);
+    payload.insert(payload.end(), body.begin(), body.end());
+    return wrapPayload(MAGIC, VERSION, payload);
+}
+
+std::optional<GameState> SaveCodec::decodeBinary(const std::vector<char>& data
+) {
+    const std::uint16_t version = checkHeader(data, MAGIC);
+    if (version == 0) {
+        return std::nullopt;
+    }
+    if (version > VERSION) {
+        Logger::error("Unsupported save file version: {}", version);
+        return std::nullopt;
+    }
+
+    Reader in(
+        data.data() + HEADER_SIZE, getLE<std::uint32_t>(data.data() + 8)
+    );
+    std::vector<std::string> strings(in.getCount(2));
+    for (auto& text : strings) {
+        text = in.getString();
+    }
+    const auto string = [&](std::uint32_t index) -> const std::string& {
+        static const std::string EMPTY;
+        if (index >= strings.size()) {
+            in.ok = false;
+            return EMPTY;
+        }
+        return strings[index];
+    };
+
+    GameState state;
+    PlayerState& player = state.player;
+    player.health = in.getI32();
+    player.x = in.getF32();
+    player.y = in.getF32();
+    player.attack = in.getI32();
+    player.defense = in.getI32();
+    player.level = in.getI32();
+    player.currentExp = in.getI32();
+    player.expToNextLevel = in.getI32();
+    player.visitedInteractions.resize(in.getCount(4));
+    for (auto& key : player.visitedInteractions) {
+        key = string(in.get<std::uint32_t>());
+    }
+
+    state.inventory.items.resize(in.getCount(8));
+    for (auto& item : state.inventory.items) {
+        item.id = string(in.get<std::uint32_t>());
+        item.quantity = in.get<std::uint32_t>();
+    }
+
+    state.map.items.resize(in.getCount(16));
+    for (auto& object : state.map.items) {
+        object.id = in.get<std::uint32_t>();
+        object.gid = in.get<std::uint32_t>();
+        object.x = in.getI32();
+        object.y = in.getI32();
+    }
+    state.rngSeed = in.get<std::uint64_t>();
+    if (version >= 2) {
+        state.region = string(in.get<std::uint32_t>());
+        state.playTime = in.get<std::uint32_t>();
+    }
+
+    if (!in.ok) {
+        Logger::error("Save file payload is malformed");
+        return std::nullopt;
+    }
+    return state;
+}
+
+std::vector<char>
+SaveCodec::encodeSlotIndex(const std::map<std::string, SlotInfo>& slots) {
+    std::vector<char> payload;
+    putLE<std::uint32_t>(payload, static_cast<std::uint32_t>(slots.size()));
+    for (const auto& [slot, info] : slots) {
+        putString(payload, slot);
+        putLE<std::uint64_t>(payload, static_cast<std::uint64_t>(info.savedAt));
+        putI32(payload, info.level);
+        putString(payload, info.region);
+        putLE<std::uint32_t>(payload, info.playTime);
+        putBytes(payload, info.thumbnail);
+    }
+    return wrapPayload(INDEX_MAGIC, INDEX_VERSION, payload);
+}
+
+std::optional<std::map<std::string, SlotInfo>>
+SaveCodec::decodeSlotIndex(const std::vector<char>& data) {
+    if (checkHeader(data, INDEX_MAGIC) != INDEX_VERSION) {
+        return std::nullopt;
+    }
+
+    const auto payloadSize = getLE<std::uint32_t>(data.data() + 8);
+    Reader in(data.data() + HEADER_SIZE, payloadSize);
+    std::map<std::string, SlotInfo> slots;
+    for (std::uint32_t count = in.getCount(2 + 8 + 4 + 2 + 4 + 4);
+         count > 0 && in.ok; --count) {
+        std::string slot = in.getString();
+        SlotInfo info;
+        info.savedAt = static_cast<std::int64_t>(in.get<std::uint64_t>());
+        info.level = in.getI32();
+        info.region = in.getString();
+        info.playTime = in.get<std::uint32_t>();
+        info.thumbnail = in.getBytes();
+        slots.insert_or_assign(std::move(slot), std::move(info));
+    }
+
+    if (!in.ok) {
+        Logger::error("Save slot index is malformed");
+        return std::nullopt;
+    }
+    return slots;
+}
+
+std::string SaveCodec::encodeJson(const GameState& state) {
+    const json j = state;
+    return j.dump(4);
+}
+
+std::optional<GameState> SaveCodec::decodeJson(std::string_view text) {
+    try {
+        return json::parse(text).get<GameState>();
+    } catch (const std::exception& e) {
+        Logger::error("Invalid JSON save: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+std::vector<char> SaveCodec::jsonToBinary(std::string_view text) {
+    const auto state = decodeJson(text);
+    return state ? encodeBinary(*state) : std::vector<char>{};
+}
+
+std::string SaveCodec::binaryToJson(const std::vector<char>& data) {
+    const auto state = decodeBinary(data);
+    return state ? encodeJson(*state) : std::string{};
+}
@@ -1,14 +1,98 @@
 #include "joanna/core/savegamemanager.h"
 
+#include "joanna/core/savecodec.h"
 #include "joanna/utils/logger.h"
-#include "nlohmann/json.hpp"
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <sstream>
 
-using json = nlohmann::json;
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// the save worker and the main thread (slot conversion) both update slots.idx
+std::mutex slotIndexMutex;
+
+// an index entry is older than its save, e.g. after a copy from a backup
+constexpr std::int64_t INDEX_TOLERANCE = 2; // seconds
+
+std::vector<char> readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file),
+             std::istreambuf_iterator<char>() };
+}
+
+bool syncFile(std::FILE* file) {
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+/**
+ * Writes to a temp file next to the target, flushes it to disk and renames
+ * it over the target, so a crash leaves either the old or the new save.
+ */
+bool writeFileAtomic(
+    const std::filesystem::path& path, const char* data, std::size_t size
+) {
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+
+    std::FILE* file = std::fopen(temp.string().c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = std::fwrite(data, 1, size, file) == size &&
+                         std::fflush(file) == 0 && syncFile(file);
+    if (std::fclose(file) != 0 || !written) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+#ifndef _WIN32
+    // persist the rename itself
+    if (const int dir = open(path.parent_path().c_str(), O_RDONLY); dir >= 0) {
+        fsync(dir);
+        close(dir);
+    }
+#endif
+    return true;
+}
+
+std::int64_t toUnixTime(const std::filesystem::file_time_type time) {
+    const auto systemTime =
+        std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+            time - std::filesystem::file_time_type::clock::now() +
+            std::chrono::system_clock::now()
+        );
+    return std::chrono::system_clock::to_time_t(systemTime);
+}
+
+std::optional<GameState>
+decode(const std::vector<char>& data, const SaveFormat format) {
+    return format == SaveFormat::Binary
+               ? SaveCodec::decodeBinary(data)
+               : SaveCodec::decodeJson({ data.data(), data.size() });
+}
+} // namespace
 
 SaveGameManager::SaveGameManager() : m_gameName("Joanna") {
     std::filesystem::create_directories(getSaveDirectory());
@@ -38,70 +122,299 @@ std::filesystem::path SaveGameManager::getSaveDirectory() const {
     return std::filesystem::current_path() / m_gameName; // fallback
 }
 
+std::filesystem::path SaveGameManager::getIndexFilePath() const {
+    return getSaveDirectory() / "slots.idx";
+}
+
+std::filesystem::path SaveGameManager::getSaveFilePath(
+    const std::string& index, const SaveFormat format
+) const {
+    return getSaveDirectory() /
+           ("savegame_" + index +
+            (format == SaveFormat::Binary ? ".sav" : ".json"));
+}
+
+// the file the slot currently uses, the binary path for an empty slot
 std::filesystem::path SaveGameManager::getSaveFilePath(const std::string& index
 ) const {
-    return getSaveDirectory() / ("savegame_" + index + ".json");
+    return getSaveFilePath(
+        index, getSlotFormat(index).value_or(SaveFormat::Binary)
+    );
+}
+
+std::optional<SaveFormat>
+SaveGameManager::getSlotFormat(const std::string& index) const {
+    if (std::filesystem::exists(getSaveFilePath(index, SaveFormat::Binary))) {
+        return SaveFormat::Binary;
+    }
+    if (std::filesystem::exists(getSaveFilePath(index, SaveFormat::Json))) {
+        return SaveFormat::Json;
+    }
+    return std::nullopt;
 }
 
 bool SaveGameManager::saveExists(const std::string& index) const {
-    return std::filesystem::exists(getSaveFilePath(index));
+    return getSlotFormat(index).has_value();
 }
 
-void SaveGameManager::saveGame(const GameState& state, const std::string& index)
+bool SaveGameManager::saveGame(const GameState& state, const std::string& index)
     const {
-    try {
-        const json j = state;
+    return saveGame(
+        state, index, getSlotFormat(index).value_or(SaveFormat::Binary)
+    );
+}
 
-        if (std::ofstream file(getSaveFilePath(index)); file.is_open()) {
-            file << j.dump(4);
+bool SaveGameManager::saveGame(
+    const GameState& state, const std::string& index, const SaveFormat format
+) const {
+    try {
+        if (!writeSave(state, index, format)) {
+            return false;
         }
+        updateSlotIndex(
+            index, { std::time(nullptr), state.player.level, state.region,
+                     state.playTime, state.thumbnail }
+        );
+        return true;
     } catch (const std::exception& e) {
         Logger::error("Failed to save game to slot {}: {}", index, e.what());
+        return false;
     }
 }
 
+bool SaveGameManager::writeSave(
+    const GameState& state, const std::string& index, const SaveFormat format
+) const {
+    const auto path = getSaveFilePath(index, format);
+    bool written = false;
+    if (format == SaveFormat::Binary) {
+        const std::vector<char> data = SaveCodec::encodeBinary(state);
+        written = writeFileAtomic(path, data.data(), data.size());
+    } else {
+        const std::string text = SaveCodec::encodeJson(state);
+        written = writeFileAtomic(path, text.data(), text.size());
+    }
+    if (!written) {
+        Logger::error("Failed to write save file {}", path.string());
+        return false;
+    }
+
+    // a slot holds one format, drop the other file
+    const SaveFormat other =
+        format == SaveFormat::Binary ? SaveFormat::Json : SaveFormat::Binary;
+    std::filesystem::remove(getSaveFilePath(index, other));
+    return true;
+}
+
 GameState SaveGameManager::loadGame(const std::string& index) const {
-    const std::filesystem::path path = getSaveFilePath(index);
+    const auto format = getSlotFormat(index);
+    if (!format) {
+        return {};
+    }
 
+    try {
+        return decode(readFile(getSaveFilePath(index, *format)), *format)
+            .value_or(GameState{});
+    } catch (const std::exception& e) {
+        Logger::error("Failed to load slot {}: {}", index, e.what());
+        return {};
+    }
+}
+
+bool SaveGameManager::convertSlot(
+    const std::string& index, const SaveFormat format
+) const {
+    const auto current = getSlotFormat(index);
+    if (!current) {
+        return false;
+    }
+    if (*current == format) {
+        return true;
+    }
+
+    const auto state =
+        decode(readFile(getSaveFilePath(index, *current)), *current);
+    if (!state) {
+        return false;
+    }
+    try {
+        if (!writeSave(*state, index, format)) {
+            return false;
+        }
+        // the decoded state has no thumbnail, keep the indexed summary
+        editSlotIndex([&](std::map<std::string, SlotInfo>& slots) {
+            const auto [it, added] = slots.try_emplace(index);
+            if (added) {
+                it->second.level = state->player.level;
+                it->second.region = state->region;
+                it->second.playTime = state->playTime;
+            }
+            it->second.savedAt = std::time(nullptr);
+        });
+        return true;
+    } catch (const std::exception& e) {
+        Logger::error("Failed to convert slot {}: {}", index, e.what());
+        return false;
+    }
+}
+
+std::map<std::string, SlotInfo> SaveGameManager::readSlotIndex() const {
+    const auto path = getIndexFilePath();
     if (!std::filesystem::exists(path)) {
         return {};
     }
+    return SaveCodec::decodeSlotIndex(readFile(path)).value_or(
+        std::map<std::string, SlotInfo>{}
+    );
+}
+
+void SaveGameManager::updateSlotIndex(
+    const std::string& index, SlotInfo info
+) const {
+    editSlotIndex([&](std::map<std::string, SlotInfo>& slots) {
+        slots.insert_or_assign(index, std::move(info));
+    });
+}
+
+void SaveGameManager::editSlotIndex(
+    const std::function<void(std::map<std::string, SlotInfo>&)>& edit
+) const {
+    const std::lock_guard lock(slotIndexMutex);
+    auto slots = readSlotIndex();
+    edit(slots);
+    const std::vector<char> data = SaveCodec::encodeSlotIndex(slots);
+    const auto path = getIndexFilePath();
+    if (!writeFileAtomic(path, data.data(), data.size())) {
+        Logger::warning("Failed to update the save slot index");
+        return;
+    }
+    // see isSlotIndexCurrent, setting the time leaves the directory alone
+    std::error_code error;
+    const auto changed =
+        std::filesystem::last_write_time(getSaveDirectory(), error);
+    if (!error) {
+        std::filesystem::last_write_time(path, changed, error);
+    }
+}
 
+// saves written before the index existed
+std::optional<SlotInfo>
+SaveGameManager::readSlotInfoFromSave(const std::string& index) const {
+    const auto format = getSlotFormat(index);
+    if (!format) {
+        return std::nullopt;
+    }
+    const auto path = getSaveFilePath(index, *format);
+    const auto state = decode(readFile(path), *format);
+    SlotInfo info;
+    info.savedAt = toUnixTime(std::filesystem::last_write_time(path));
+    if (state) {
+        info.level = state->player.level;
+        info.region = state->region;
+        info.playTime = state->playTime;
+    }
+    return info;
+}
+
+std::vector<std::optional<SlotInfo>>
+SaveGameManager::getSlotInfos(const std::vector<std::string>& indices) const {
+    std::vector<std::optional<SlotInfo>> infos;
+    infos.reserve(indices.size());
     try {
-        std::ifstream file(path);
-        json j;
-        file >> j;
+        auto slots = readSlotIndex();
+        if (isSlotIndexCurrent()) {
+            for (const auto& index : indices) {
+                const auto it = slots.find(index);
+                if (it == slots.end()) {
+                    infos.emplace_back();
+                } else {
+                    infos.emplace_back(std::move(it->second));
+                }
+            }
+            return infos;
+        }
 
-        return j.get<GameState>();
+        // saves were added, replaced or deleted behind our back
+        std::map<std::string, std::optional<SlotInfo>> rebuilt;
+        for (const auto& index : indices) {
+            auto info = readSlotInfoFromSave(index);
+            const auto it = slots.find(index);
+            if (info && it != slots.end() &&
+                info->savedAt <= it->second.savedAt + INDEX_TOLERANCE) {
+                info = std::move(it->second); // keeps the thumbnail
+            }
+            rebuilt.insert_or_assign(index, info);
+            infos.push_back(std::move(info));
+        }
 
+        // rewritten even if nothing changed, so the index is current again;
+        // re-checked under the lock, the worker may have saved meanwhile
+        editSlotIndex([&](std::map<std::string, SlotInfo>& current) {
+            for (auto& [slot, info] : rebuilt) {
+                if (!info) {
+                    if (!saveExists(slot)) {
+                        current.erase(slot);
+                    }
+                    continue;
+                }
+                const auto it = current.find(slot);
+                if (it == current.end() || it->second.savedAt < info->savedAt) {
+                    current.insert_or_assign(slot, std::move(*info));
+                }
+            }
+        });
     } catch (const std::exception& e) {
-        return {};
+        Logger::error("Failed to read save slots: {}", e.what());
+        infos.resize(indices.size());
     }
+    return infos;
 }
 
-std::string SaveGameManager::getSaveInfo(const std::string& index) const {
-    const auto path = getSaveFilePath(index);
+// Saves are written by renaming a temp file, which touches the directory,
+// and the index is stamped with the directory time after every write. A
+// newer directory means saves were added, replaced or deleted since. Saves
+// overwritten in place are not noticed.
+bool SaveGameManager::isSlotIndexCurrent() const {
+    std::error_code error;
+    const auto stamped =
+        std::filesystem::last_write_time(getIndexFilePath(), error);
+    if (error) {
+        return false;
+    }
+    const auto changed =
+        std::filesystem::last_write_time(getSaveDirectory(), error);
+    return !error && changed <= stamped;
+}
 
-    if (!std::filesystem::exists(path)) {
+std::string SaveGameManager::describeSlot(const SlotInfo& info) {
+    const std::uint32_t hours = info.playTime / 3600;
+    const std::uint32_t minutes = (info.playTime / 60) % 60;
+    std::stringstream ss;
+    ss << "Lv " << info.level;
+    if (!info.region.empty()) {
+        ss << "  " << info.region;
+    }
+    ss << "\nPlayed " << hours << ':' << std::setw(2) << std::setfill('0')
+       << minutes;
+    return ss.str();
+}
+
+std::string SaveGameManager::getSaveInfo(const std::string& index) const {
+    const auto info = getSlotInfos({ index }).front();
+    if (!info) {
         return "Empty";
     }
+    return formatTimestamp(info->savedAt);
+}
 
-    try {
-        // last update time of the file
-        const auto ftime = std::filesystem::last_write_time(path);
-
-        const auto systemTime =
-            std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                ftime - std::filesystem::file_time_type::clock::now() +
-                std::chrono::system_clock::now()
-            );
-        const std::time_t cftime = std::chrono::system_clock::to_time_t(systemTime);
-
-        // Format the time (e.g., "YYYY-MM-DD HH:MM")
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&cftime), "%Y-%m-%d %H:%M");
-        return ss.str();
-    } catch (...) {
-        return "Unknown"; // Fallback if permission/conversion fails
-    }
-}
\ No newline at end of file
+std::string SaveGameManager::formatTimestamp(const std::int64_t savedAt) {
+    const auto time = static_cast<std::time_t>(savedAt);
+    const std::tm* local = std::localtime(&time);
+    if (local == nullptr) {
+        return "Unknown";
+    }
+    // Format the time (e.g., "YYYY-MM-DD HH:MM")
+    std::stringstream ss;
+    ss << std::put_time(local, "%Y-%m-%d %H:%M");
+    return ss.str();
+}
@@ -0,0 +1,85 @@
+#include "joanna/core/saveworker.h"
+
+#include <algorithm>
+#include <utility>
+
+SaveWorker::SaveWorker() : worker([this] { run(); }) {}
+
+SaveWorker::~SaveWorker() {
+    {
+        const std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    // queued saves are still written before the thread exits
+    worker.join();
+}
+
+void SaveWorker::submit(GameState state, std::string slot, Callback onDone) {
+    {
+        std::unique_lock lock(mutex);
+        auto queued =
+            std::find_if(pending.begin(), pending.end(), [&](const Job& job) {
+                return job.slot == slot;
+            });
+        if (queued == pending.end()) {
+            drained.wait(lock, [this] { return pending.size() < MAX_PENDING; });
+            pending.push_back({ std::move(slot), {}, {} });
+            queued = std::prev(pending.end());
+        }
+        queued->state = std::move(state);
+        if (onDone) {
+            queued->callbacks.push_back(std::move(onDone));
+        }
+    }
+    wake.notify_one();
+}
+
+void SaveWorker::poll() {
+    std::vector<Result> results;
+    {
+        const std::lock_guard lock(mutex);
+        results.swap(finished);
+    }
+    for (const Result& result : results) {
+        for (const Callback& callback : result.callbacks) {
+            callback(result.success);
+        }
+    }
+}
+
+void SaveWorker::flush() {
+    {
+        std::unique_lock lock(mutex);
+        drained.wait(lock, [this] { return pending.empty() && !writing; });
+    }
+    poll();
+}
+
+bool SaveWorker::isIdle() const {
+    const std::lock_guard lock(mutex);
+    return pending.empty() && !writing;
+}
+
+void SaveWorker::run() {
+    const SaveGameManager manager;
+    std::unique_lock lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) {
+            return; // stopping and drained
+        }
+
+        Job job = std::move(pending.front());
+        pending.pop_front();
+        writing = true;
+        lock.unlock();
+
+        const bool success = manager.saveGame(job.state, job.slot);
+
+        lock.lock();
+        writing = false;
+        finished.push_back({ success, std::move(job.callbacks) });
+        drained.notify_all();
+    }
+}
@@ -1,10 +1,10 @@
 #include "joanna/entities/enemy.h"
 #include "joanna/entities/player.h"
+#include "joanna/game/combat/combatrules.h"
 #include "joanna/utils/resourcemanager.h"
 #include "joanna/world/tilemanager.h"
 
 #include <algorithm>
-#include <cstdlib> // for rand
 
 Enemy::Enemy(const sf::Vector2f& startPos, EnemyType type)
     : Entity(
@@ -19,7 +19,8 @@ Enemy::Enemy(const sf::Vector2f& startPos, EnemyType type)
           // no hitbox for now
           std::nullopt, Direction::Right
       ),
-      homePoint(startPos), patrolTarget(startPos), type(type) {
+      homePoint(startPos), patrolTarget(startPos), type(type),
+      rng(Random::fork(RngStream::EnemyAI, getId())) {
 
     std::string basePath = type == EnemyType::Goblin
                                ? "assets/player/enemies/goblin/"
@@ -63,25 +64,18 @@ Enemy::Enemy(const sf::Vector2f& startPos, EnemyType type)
     applyFrame();
 
     // Initialize attacks
-    if (type == EnemyType::Goblin) {
-        attacks.push_back({ "Mining", 50, State::Mining, 0.4f, 0.9f, 0.f, 130.f,
-                            5.f, true, 0.1f, 0.43f, 130.f });
-        attacks.push_back({ "Roll", 30, State::Roll, 0.2f, 0.8f, -800.f, 85.f,
-                            -5.f, true, 0.16f, 0.23f, 280.f });
-        // set healöth higher
-        maxHealth = 200;
-        health = maxHealth;
-    } else {
-        // Skeleton attacks
-        attacks.push_back({ "Attack", 30, State::Attack, 0.32f, 0.7f, 0.f,
-                            100.f, 5.f, true, 0.05f, 0.35f, 100.f });
-    }
+    attacks = CombatRules::enemyAttacks(type);
+    maxHealth = CombatRules::enemy(type).health;
+    health = maxHealth;
 }
 
-void Enemy::update(float dt, State state) {
+void Enemy::update(float dt, State state, bool animate) {
     if (currentState != state) {
         switchState(state);
     }
+    if (!animate) {
+        return;
+    }
 
     this->frameTimer += dt;
     const auto& anim = animations[this->currentState];
@@ -129,7 +123,10 @@ void Enemy::takeDamage(int amount) {
     health = std::max(health - amount, 0);
 }
 
-int Enemy::updateOverworld(float dt, Player& player, TileManager& tileManager) {
+int Enemy::updateOverworld(
+    const AiTick& tick, Player& player, TileManager& tileManager
+) {
+    const float dt = tick.dt;
     const sf::Vector2f playerPos = player.getPosition();
     const sf::Vector2f myPos = getPosition();
     const auto distToPlayer = getDistance(playerPos, myPos);
@@ -138,27 +135,34 @@ int Enemy::updateOverworld(float dt, Player& player, TileManager& tileManager) {
         return COMBAT_TRIGGERED;
     }
 
-    updateAIState(dt, myPos, playerPos, distToPlayer, tileManager);
+    updateAIState(tick, myPos, playerPos, distToPlayer, tileManager);
 
     State nextAnimState = State::Idle;
 
     if (aiState == OverworldState::Idle) {
         nextAnimState = handleIdleBehavior(dt, myPos);
     } else if (aiState == OverworldState::Pursuing) {
-        nextAnimState =
-            handlePursuingBehavior(dt, myPos, playerPos, distToPlayer);
+        nextAnimState = handlePursuingBehavior(
+            dt, myPos, playerPos, distToPlayer, tileManager.getNavGrid()
+        );
     }
     // graphical update
-    update(dt, nextAnimState);
+    update(dt, nextAnimState, tick.visible);
     return COMBAT_IDLE;
 }
 
 void Enemy::updateAIState(
-    float dt, const sf::Vector2f& myPos, const sf::Vector2f& playerPos,
-    float distToPlayer, TileManager& tileManager
+    const AiTick& tick, const sf::Vector2f& myPos,
+    const sf::Vector2f& playerPos, float distToPlayer, TileManager& tileManager
 ) {
+    const float dt = tick.dt;
     const float torchRadius = 100.f; // player "brightness"
-    const bool hasLOS = tileManager.checkLineOfSight(myPos, playerPos);
+    if (tick.refreshSight) {
+        // the ray is only worth casting when the player could be noticed
+        hasLineOfSight = distToPlayer < torchRadius &&
+                         tileManager.checkLineOfSight(myPos, playerPos);
+    }
+    const bool hasLOS = hasLineOfSight;
 
     if (aiState == OverworldState::Idle) {
         if (hasLOS && distToPlayer < torchRadius) {
@@ -187,8 +191,10 @@ State Enemy::handleIdleBehavior(float dt, const sf::Vector2f& myPos) {
     patrolTimer -= dt;
     if (patrolTimer <= 0.f) {
         const float radius = 30.f;
-        const float angle = static_cast<float>(rand() % 360) * 3.14159f / 180.f;
-        const float dist = static_cast<float>(rand() % 100) / 100.f * radius;
+        const float angle =
+            static_cast<float>(rng.nextBelow(360)) * 3.14159f / 180.f;
+        const float dist =
+            static_cast<float>(rng.nextBelow(100)) / 100.f * radius;
         sf::Vector2f potentialTarget =
             homePoint +
             sf::Vector2f(std::cos(angle) * dist, std::sin(angle) * dist);
@@ -223,11 +229,15 @@ bool Enemy::shouldTriggerCombat(float distToPlayer) {
 
 State Enemy::handlePursuingBehavior(
     float dt, const sf::Vector2f& myPos, const sf::Vector2f& playerPos,
-    float distToPlayer
+    float distToPlayer, const NavGrid& navGrid
 ) {
-    sf::Vector2f dir = playerPos - myPos;
+    // follow the shared flow field around obstacles, straight line once the
+    // player is in reach (same cell) or the field does not cover us
+    sf::Vector2f dir = navGrid.flowDirection(myPos);
+    if (dir.x == 0.f && dir.y == 0.f) {
+        dir = (playerPos - myPos) / distToPlayer;
+    }
     setFacing(dir.x > 0 ? Direction::Right : Direction::Left);
-    dir /= distToPlayer;
     const sf::Vector2f move = dir * speed * dt;
     const sf::Vector2f nextPos = myPos + move;
     const auto distNextToHome = getDistance(nextPos, homePoint);
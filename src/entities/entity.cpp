@@ -15,6 +15,10 @@ void Entity::render(sf::RenderTarget& target) const {
     target.draw(*sprite);
 }
 
+void Entity::render(SpriteBatch& batch) const {
+    batch.add(*sprite);
+}
+
 uint32_t Entity::getId() const {
     return id;
 }
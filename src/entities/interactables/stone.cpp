@@ -8,13 +8,13 @@ Stone::Stone(const sf::Vector2f& position, std::string id)
           "assets/buttons/interact_T.png", "assets/interactables/stone.png",
           sf::FloatRect(position, { 16.f, 16.f }) // Collision box
       ),
-      id(std::move(id)) {
+      id(std::move(id)), flag(FlagRegistry::getInstance().intern(this->id)) {
     // Initial frame
     setFrame(sf::IntRect({ 0, 0 }, { 16, 16 }));
 }
 
 void Stone::interact(Player& player) {
-    if (!player.getInventory().hasItemByName("pickaxe")) {
+    if (!player.getInventory().hasItem(Items::Pickaxe)) {
         return;
     }
     if (waitingForHit) {
@@ -2,7 +2,8 @@
 #include <algorithm>
 #include <cmath>
 
-json NPC::jsonData;
+DialogueTable NPC::dialogues;
+NavGrid* NPC::navGrid = nullptr;
 
 NPC::NPC(
     const sf::Vector2f& startPos, const std::string& npcIdlePath,
@@ -23,13 +24,17 @@ NPC::NPC(
     } else {
         animations[State::Walking] = animations[State::Idle];
     }
-    auto rawList = jsonData[dialogId];
+    dialogue = dialogues.getEntries(this->dialogId);
 
-    std::sort(rawList.begin(), rawList.end(), [](const json& a, const json& b) {
-        return a["priority"] > b["priority"];
-    });
-
-    this->sortedDialogue = rawList;
+    // the flags marking an entry as seen only depend on this NPC, build once
+    visitedFlags.reserve(dialogue.size());
+    for (const auto& entry : dialogue) {
+        visitedFlags.push_back(
+            entry.id == DialogueEntry::NO_ID
+                ? NO_FLAG
+                : flagFor(dialogues.getName(entry.id))
+        );
+    }
 }
 
 NPC::NPC(
@@ -40,84 +45,55 @@ NPC::NPC(
         std::string dialogId
     ) : NPC(startPos, npcIdlePath, "", buttonTexturePath, dialogueBox, dialogId) {}
 
+FlagId NPC::flagFor(std::string_view entryId) const {
+    std::string key = uniqueSpriteId;
+    key += '_';
+    key += entryId;
+    return FlagRegistry::getInstance().intern(key);
+}
+
 void NPC::setDialogue(const std::vector<std::string>& messages) {
     if (dialogueBox) {
         dialogueBox->setDialogue(messages);
     }
 }
 
-std::string createKey(
-    const nlohmann::json& entry, const Player& player,
-    const std::string& uniqueSpriteId
+bool canFulfillRequirements(
+    const DialogueRequirement& req, Player& player
 ) {
-    std::string result = "";
-    if (entry.contains("id")) {
-        result = uniqueSpriteId + "_" + std::string(entry["id"]);
-        if (player.hasInteraction(result)) {
-            result = "alreadySeen";
-        }
-    }
-    return result;
-}
-
-bool canFulfillRequirements(const nlohmann::json& entry, Player& player) {
-    if (!entry.contains("req") || entry["req"].is_null()) {
+    if (req.type == RequirementType::None) {
         return true;
     }
-
-    const auto& req = entry["req"];
-    std::string type = req["type"];
-
-    if (type.find("ITEM") != std::string::npos) {
-        std::string itemId = req["id"];
-        int amount = req["amount"];
-
-        if (player.getInventory().getQuantity(itemId) < amount) {
-            return false;
-        }
-    }
-
-    return true;
+    return player.getInventory().getQuantity(req.item) >= req.amount;
 }
 
-void payRequirementCost(const nlohmann::json& entry, Player& player) {
-    if (!entry.contains("req") || entry["req"].is_null()) {
-        return;
-    }
-
-    const auto& req = entry["req"];
-    std::string type = req["type"];
-
-    if (type == "ITEM_REMOVE") {
-        std::string itemId = req["id"];
-        int amount = req["amount"];
-        player.getInventory().removeItem(itemId, amount);
+void payRequirementCost(const DialogueRequirement& req, Player& player) {
+    if (req.type == RequirementType::ItemRemove) {
+        player.getInventory().removeItem(req.item, req.amount);
     }
 }
 
 void NPC::interact(Player& player) {
-    for (auto& entry : sortedDialogue) {
-        std::string uniqueKey = createKey(entry, player, this->uniqueSpriteId);
-        if (uniqueKey == "alreadySeen") {
+    for (std::size_t i = 0; i < dialogue.size(); ++i) {
+        const DialogueEntry& entry = dialogue[i];
+        const FlagId visited = visitedFlags[i];
+        if (visited != NO_FLAG && player.hasFlag(visited)) {
             continue;
         }
 
-        if (canFulfillRequirements(entry, player)) {
-            payRequirementCost(entry, player);
-            dialogueBox->setDialogue(entry["text"], this);
+        if (canFulfillRequirements(entry.requirement, player)) {
+            payRequirementCost(entry.requirement, player);
+            dialogueBox->setDialogue(entry.text, this);
             dialogueBox->show();
-            if (!uniqueKey.empty()) {
-                player.addInteraction(uniqueKey);
+            if (visited != NO_FLAG) {
+                player.setFlag(visited);
             }
-            if (!entry["reward"].is_null()) {
-                json reward = entry["reward"];
-                pendingReward = Item(reward["id"], reward["name"]);
+            if (entry.reward.has_value()) {
+                pendingReward = entry.reward;
             }
-            if (!entry["move"].is_null()) {
-                pendingMove = entry["move"];
-                if (entry.contains("id")) {
-                    pendingActionId = entry["id"];
-                }
+            if (entry.hasMove) {
+                pendingMove = &entry;
+                pendingActionId = entry.id;
             }
             return;
         }
@@ -181,25 +157,26 @@ void NPC::update(float dt, Player& player) {
         }
     }
 
-    if (pendingMove.has_value()) {
+    if (pendingMove != nullptr) {
         if (dialogueBox->getOwner() != this || !dialogueBox->isActive()) {
-            move(pendingMove.value());
-            pendingMove.reset();
-            if (!pendingActionId.empty()) {
+            move(pendingMove->move);
+            pendingMove = nullptr;
+            if (pendingActionId != DialogueEntry::NO_ID) {
                 if (onAction) {
-                    onAction(pendingActionId);
+                    onAction(dialogues.getName(pendingActionId));
                 }
-                pendingActionId.clear();
+                pendingActionId = DialogueEntry::NO_ID;
             }
         }
     }
 }
 
 void NPC::triggerMove(const std::string& actionId) {
-    for (auto& entry : sortedDialogue) {
-        if (entry.contains("id") && entry["id"] == actionId) {
-            if (entry.contains("move") && !entry["move"].is_null()) {
-                move(entry["move"]);
+    const std::uint32_t id = dialogues.findId(actionId);
+    for (const auto& entry : dialogue) {
+        if (id != DialogueEntry::NO_ID && entry.id == id) {
+            if (entry.hasMove) {
+                move(entry.move);
             }
             return;
         }
@@ -212,25 +189,24 @@ void NPC::applyFrame() {
     setFrame(anim.frames[currentFrame]);
 }
 
-void NPC::move(const json& moveData) {
-    if (!moveData.is_array())
-        return;
+void NPC::move(const std::vector<sf::Vector2f>& steps) {
     sf::Vector2f futurePos = getPosition();
 
-    for (const auto& step : moveData) {
-        float x = 0.f;
-        float y = 0.f;
-
-        if (step.contains("x")) {
-            x = step["x"].get<float>();
-        }
-
-        if (step.contains("y")) {
-            y = step["y"].get<float>();
+    for (const auto& step : steps) {
+        const sf::Vector2f from = futurePos;
+        futurePos += step;
+
+        // hand-authored waypoints are kept unless the straight segment runs
+        // into the map; then take the A* detour if there is one
+        if (navGrid != nullptr && navGrid->isBaked() &&
+            !navGrid->isSegmentWalkable(from, futurePos) &&
+            navGrid->findPath(from, futurePos, pathBuffer)) {
+            movementQueue.insert(
+                movementQueue.end(), pathBuffer.begin(), pathBuffer.end()
+            );
+        } else {
+            movementQueue.push_back(futurePos);
         }
-
-        futurePos += sf::Vector2f(x, y);
-        movementQueue.push_back(futurePos);
     }
     isMoving = true;
 }
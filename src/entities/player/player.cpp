@@ -1,6 +1,7 @@
 #include "joanna/entities/player.h"
 #include <iostream>
 
+#include "joanna/game/combat/combatrules.h"
 #include "joanna/systems/audiomanager.h"
 #include "joanna/utils/resourcemanager.h"
 #include "joanna/world/tilemanager.h"
@@ -15,7 +16,8 @@ Player::Player(
           sf::FloatRect({ startPos.x - 5.f, startPos.y - 2.f }, { 10.f, 9.f }),
           Direction::Right
       ),
-      health(200), maxHealth(200), inventory(20) {
+      health(CombatRules::PLAYER_HEALTH),
+      maxHealth(CombatRules::PLAYER_HEALTH), inventory(20) {
     this->animations[State::Idle] = Animation(idlePath, { 96, 64 }, 9);
     this->animations[State::Walking] = Animation(walkPath, { 96, 64 }, 8);
     this->animations[State::Running] = Animation(runPath, { 96, 64 }, 8);
@@ -108,10 +110,10 @@ void Player::draw(sf::RenderTarget& target) const {
 void Player::addItemToInventory(
     const Item& item, const std::uint32_t quantity
 ) {
-    if (item.name == "shield") {
-        this->stats.defense += 3;
-    } else if (item.name == "sword") {
-        this->stats.attack += 3;
+    if (item.id == Items::Shield) {
+        this->stats.defense += CombatRules::SHIELD_DEFENSE;
+    } else if (item.id == Items::Sword) {
+        this->stats.attack += CombatRules::SWORD_ATTACK;
     }
     this->inventory.addItem(item, quantity);
 }
@@ -123,43 +125,13 @@ void Player::takeDamage(int amount) {
               << "\n";
 }
 
-void Player::displayHealthBar(
-    sf::RenderTarget& target, TileManager& tileManager
-) const {
-    auto heartIcon = tileManager.getTextureById(3052);
-    auto halfHeartIcon = tileManager.getTextureById(3054);
-    const auto size = target.getView().getSize();
-    const sf::Vector2f startPos(
-        (-size.x / 2) + heartIcon.getLocalBounds().size.x,
-        (-size.y / 2) + heartIcon.getLocalBounds().size.y
-    );
-    int fullHearts = this->health / 20;
-    bool showHalfHeart =
-        (this->health % 20) >= 10 || (this->health > 0 && fullHearts == 0);
-
-    for (int i = 0; i < fullHearts; ++i) {
-        heartIcon.setPosition({ startPos.x + (static_cast<float>(i) * 32.f),
-                                startPos.y });
-        heartIcon.setScale({ 3.f, 3.f });
-        target.draw(heartIcon);
-    }
-
-    if (showHalfHeart) {
-        halfHeartIcon.setPosition(
-            { startPos.x + (static_cast<float>(fullHearts) * 32.f), startPos.y }
-        );
-        halfHeartIcon.setScale({ 3.f, 3.f });
-        target.draw(halfHeartIcon);
-    }
-}
-
-bool Player::applyItem(const std::string& itemId) {
-    if (itemId == "1330") {
+bool Player::applyItem(const ItemId itemId) {
+    if (itemId == Items::Heal) {
         this->health += 50;
         this->inventory.removeItem(itemId, 1);
         return true;
     }
-    if (itemId == "703") {
+    if (itemId == Items::Mushroom) {
         this->stats.attack += 3;
         this->inventory.removeItem(itemId, 1);
         return true;
@@ -190,8 +162,8 @@ void Player::levelUp() {
 
     this->expToNextLevel = static_cast<int>((float)this->expToNextLevel * 1.2f);
 
-    this->stats.attack += 2;
-    this->stats.defense += 1;
+    this->stats.attack += CombatRules::ATTACK_PER_LEVEL;
+    this->stats.defense += CombatRules::DEFENSE_PER_LEVEL;
     this->health = maxHealth;
 
     if (levelUpListener) {
@@ -200,7 +172,7 @@ void Player::levelUp() {
 }
 
 void Player::resetStats() {
-    stats = Stats(10, 10);
+    stats = Stats(CombatRules::BASE_ATTACK, CombatRules::BASE_DEFENSE);
     level = 1;
     currentExp = 0;
     expToNextLevel = 10;
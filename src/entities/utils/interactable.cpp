@@ -25,5 +25,5 @@ bool Interactable::canPlayerInteract(const sf::Vector2f& playerPos) {
     sf::Vector2f pos = this->getPosition();
     float dx = playerPos.x - pos.x;
     float dy = playerPos.y - pos.y;
-    return dx * dx + dy * dy <= interactionDistance * interactionDistance;
+    return dx * dx + dy * dy <= INTERACTION_DISTANCE * INTERACTION_DISTANCE;
 }
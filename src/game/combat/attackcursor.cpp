@@ -0,0 +1,20 @@
+#include "joanna/game/combat/attackcursor.h"
+
+void AttackCursor::start(const Attack& attack) {
+    keys = attack.timeline;
+    size = attack.timelineSize;
+    next = 0;
+    passed = 0;
+    time = 0.f;
+}
+
+AttackCursor::Events AttackCursor::advance(const float dt) {
+    time += dt;
+    Events reached = 0;
+    while (next < size && keys[next].time <= time) {
+        reached |= bit(keys[next].event);
+        ++next;
+    }
+    passed |= reached;
+    return reached;
+}
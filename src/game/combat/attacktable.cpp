@@ -0,0 +1,157 @@
+#include "joanna/game/combat/attacktable.h"
+
+#include "joanna/utils/logger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+std::string& dataPath() {
+    static std::string path = AttackTable::DEFAULT_PATH;
+    return path;
+}
+
+State parseAnimation(const std::string& name) {
+    static constexpr std::array<std::pair<std::string_view, State>, 9> STATES =
+        { { { "idle", State::Idle },
+            { "walking", State::Walking },
+            { "running", State::Running },
+            { "attack", State::Attack },
+            { "roll", State::Roll },
+            { "hurt", State::Hurt },
+            { "dead", State::Dead },
+            { "mining", State::Mining },
+            { "counter", State::Counter } } };
+    for (const auto& [key, state] : STATES) {
+        if (key == name) {
+            return state;
+        }
+    }
+    throw std::runtime_error("Unknown attack animation: " + name);
+}
+
+Attack compileAttack(const nlohmann::json& raw) {
+    Attack attack;
+    attack.name = raw.at("name").get<std::string>();
+    attack.damage = raw.at("damage").get<int>();
+    attack.animationState = parseAnimation(raw.at("animation"));
+    attack.impactTime = raw.at("impact").get<float>();
+    attack.endTime = raw.at("end").get<float>();
+    attack.approachOffset = raw.value("approachOffset", 0.f);
+
+    if (raw.contains("move")) {
+        const auto& move = raw["move"];
+        attack.moveSpeed = move.value("speed", 0.f);
+        attack.targetOffset = move.value("targetOffset", 0.f);
+        attack.moveThreshold = move.value("threshold", 5.f);
+    }
+    if (raw.contains("counter")) {
+        const auto& window = raw["counter"];
+        attack.counterable = true;
+        attack.counterWindowStart = window.at(0).get<float>();
+        attack.counterWindowEnd = window.at(1).get<float>();
+    }
+
+    AttackTable::buildTimeline(attack);
+    return attack;
+}
+
+} // namespace
+
+AttackTable AttackTable::compile(const nlohmann::json& data) {
+    AttackTable table;
+
+    const auto& player = data.at("player");
+    table.playerAttacks.at(static_cast<std::size_t>(PlayerAction::Attack)) =
+        compileAttack(player.at("attack"));
+    table.playerAttacks.at(static_cast<std::size_t>(PlayerAction::Roll)) =
+        compileAttack(player.at("roll"));
+
+    for (const auto& [name, raw] : data.at("enemies").items()) {
+        EnemyDefinition enemy;
+        enemy.name = name;
+        enemy.health = raw.value("health", 100);
+        for (const auto& attack : raw.at("attacks")) {
+            enemy.attacks.push_back(compileAttack(attack));
+        }
+        if (enemy.attacks.empty()) {
+            throw std::runtime_error("Enemy without attacks: " + name);
+        }
+        table.enemies.push_back(std::move(enemy));
+    }
+    return table;
+}
+
+void AttackTable::setPath(std::string path) {
+    dataPath() = std::move(path);
+}
+
+const AttackTable& AttackTable::getInstance() {
+    static const AttackTable instance = [] {
+        std::ifstream file(dataPath());
+        try {
+            return compile(nlohmann::json::parse(file));
+        } catch (const std::exception& e) {
+            Logger::error("Failed to load {}: {}", dataPath(), e.what());
+            throw;
+        }
+    }();
+    return instance;
+}
+
+const EnemyDefinition* AttackTable::findEnemy(std::string_view name) const {
+    const auto it = std::find_if(
+        enemies.begin(), enemies.end(),
+        [name](const EnemyDefinition& enemy) { return enemy.name == name; }
+    );
+    return it != enemies.end() ? &*it : nullptr;
+}
+
+const EnemyDefinition& AttackTable::getEnemy(std::string_view name) const {
+    const EnemyDefinition* enemy = findEnemy(name);
+    if (enemy == nullptr) {
+        throw std::runtime_error("No attacks for enemy " + std::string(name));
+    }
+    return *enemy;
+}
+
+const EnemyDefinition& AttackTable::getEnemy(const EnemyType type) const {
+    return getEnemy(getName(type));
+}
+
+std::string_view AttackTable::getName(const EnemyType type) {
+    switch (type) {
+        case EnemyType::Goblin:
+            return "goblin";
+        case EnemyType::Skeleton:
+            return "skeleton";
+        default:
+            throw std::invalid_argument("Invalid EnemyType");
+    }
+}
+
+void AttackTable::buildTimeline(Attack& attack) {
+    attack.timelineSize = 0;
+    const auto add = [&attack](const float time, const AttackEvent event) {
+        attack.timeline.at(attack.timelineSize++) = { time, event };
+    };
+    if (attack.counterable) {
+        add(attack.counterWindowStart, AttackEvent::CounterOpen);
+    }
+    add(attack.impactTime, AttackEvent::Impact);
+    if (attack.counterable) {
+        add(attack.counterWindowEnd, AttackEvent::CounterClose);
+    }
+    add(attack.endTime, AttackEvent::End);
+
+    // ties keep the enum order, so a window closing at impact still counts
+    std::stable_sort(
+        attack.timeline.begin(), attack.timeline.begin() + attack.timelineSize,
+        [](const AttackKey& a, const AttackKey& b) {
+            return a.time < b.time;
+        }
+    );
+}
@@ -1,11 +1,13 @@
 #include "joanna/game/combat/combat_system.h"
+#include "joanna/game/combat/combatrules.h"
+#include "joanna/utils/random.h"
 #include "joanna/utils/resourcemanager.h"
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Window/Event.hpp>
 #include <iostream>
 
-CombatSystem::CombatSystem()
-    : caveBackground(ResourceManager<sf::Texture>::getInstance()->get(
+CombatSystem::CombatSystem(AudioManager& audioManager)
+    : audioManager(audioManager),
+      caveBackground(ResourceManager<sf::Texture>::getInstance()->get(
           "assets/images/combat_background_cave.png"
       )),
       beachBackground(ResourceManager<sf::Texture>::getInstance()->get(
@@ -25,9 +27,7 @@ CombatSystem::CombatSystem()
       )),
       counterButtonBadTexture(ResourceManager<sf::Texture>::getInstance()->get(
           "assets/buttons/attack_punch_bad.png"
-      )) {
-    audioManager = AudioManager();
-}
+      )) {}
 
 void CombatSystem::startCombat(Player& p, Enemy& e) {
     player = &p;
@@ -66,6 +66,8 @@ void CombatSystem::startCombat(Player& p, Enemy& e) {
     eState = State::Idle;
     pState = State::Idle;
     victoryTimer = 0.0f;
+    stepTime = 0.0f;
+    damageIndicators.clear();
 }
 
 void CombatSystem::endCombat() {
@@ -88,10 +90,16 @@ bool CombatSystem::battleFinished() const {
 }
 
 void CombatSystem::update(float dt) {
+    // the rules advance in fixed steps, so timing windows do not depend on
+    // the frame rate
+    stepTime = std::min(stepTime + (dt * TIME_SCALE), MAX_STEPS * STEP);
+    while (stepTime >= STEP) {
+        step(STEP);
+        stepTime -= STEP;
+    }
+}
 
-    dt -= 0.007f; // just for visual purpose
-    static AudioManager dummyAudio;
-
+void CombatSystem::step(float dt) {
     if (currentState == CombatState::PlayerTurn) {
         updatePlayerTurn(dt, pState, eState);
     } else if (currentState == CombatState::EnemyTurn) {
@@ -102,20 +110,11 @@ void CombatSystem::update(float dt) {
     }
 
     player->update(
-        dt, pState, player->getFacing() == Direction::Left, dummyAudio
+        dt, pState, player->getFacing() == Direction::Left, audioManager
     );
     enemy->update(dt, eState);
 
-    for (auto it = damageTexts.begin(); it != damageTexts.end();) {
-        it->lifeTime -= dt;
-        it->position.y -= it->speed * dt;
-
-        if (it->lifeTime <= 0.f) {
-            it = damageTexts.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    damageIndicators.update(dt);
 }
 
 void CombatSystem::processApproach(
@@ -135,7 +134,7 @@ void CombatSystem::processApproach(
         );
     } else {
         phase = TurnPhase::Attacking;
-        turnTimer = 0.0f;
+        attackCursor.start(currentAttack);
     }
 }
 
@@ -190,36 +189,38 @@ void CombatSystem::updateAttackTimeline(
     float dt, Defender* defender, State& defenderState, const Attack& attack,
     Attacker* attacker
 ) {
-    if (turnTimer < attack.impactTime) {
+    const AttackCursor::Events events = attackCursor.advance(dt);
+
+    if (!attackCursor.hasPassed(AttackEvent::Impact)) {
         if (defenderState != State::Counter) {
             defenderState = State::Idle;
         }
-    } else if (turnTimer < attack.endTime) {
+    } else if (!attackCursor.isDone()) {
         defenderState = State::Hurt;
-        if (!damageDealt) {
-            int defense = 0;
-            int damage = attack.damage;
+    }
 
-            if constexpr (std::is_same_v<Defender, Player>) {
-                defense = defender->getStats().defense;
-            } else {
-                damage += attacker->getStats().attack;
-            }
-            int finalDamage = std::max(0, damage - defense);
-            defender->takeDamage(finalDamage);
-            spawnDamageText(defender, finalDamage);
-            damageDealt = true;
-            audioManager.play_sfx(SfxId::Hit);
-            Logger::info(
-                "Defender took damage: " + std::to_string(damage - defense) +
-                " remaining: " + std::to_string(defender->getHealth())
+    if ((events & AttackCursor::bit(AttackEvent::Impact)) != 0) {
+        int finalDamage = 0;
+        if constexpr (std::is_same_v<Defender, Player>) {
+            finalDamage = CombatRules::damageToPlayer(
+                attack, defender->getStats().defense
             );
+        } else {
+            finalDamage =
+                CombatRules::damageToEnemy(attack, attacker->getStats().attack);
         }
-    } else {
+        defender->takeDamage(finalDamage);
+        spawnDamageText(defender, finalDamage);
+        audioManager.play_sfx(SfxId::Hit);
+        Logger::info(
+            "Defender took damage: " + std::to_string(finalDamage) +
+            " remaining: " + std::to_string(defender->getHealth())
+        );
+    }
+
+    if (attackCursor.isDone()) {
         defenderState = State::Idle;
         phase = TurnPhase::Returning;
-        turnTimer = 0.0f;
-        damageDealt = false;
     }
 }
 
@@ -232,8 +233,6 @@ void CombatSystem::processAttack(
 
     updateAttackMovement(dt, attacker, defender->getPosition(), attack);
     updateAttackTimeline(dt, defender, defenderState, attack, attacker);
-
-    turnTimer += dt;
 }
 
 void CombatSystem::updatePlayerTurn(float dt, State& pState, State& eState) {
@@ -255,7 +254,7 @@ void CombatSystem::updatePlayerTurn(float dt, State& pState, State& eState) {
             eState = State::Dead;
             currentState = CombatState::Victory;
             std::cout << "Victory!\n";
-            player->gainExp(5);
+            player->gainExp(CombatRules::VICTORY_EXP);
         } else {
             currentState = CombatState::EnemyTurn;
             phase = TurnPhase::Input;
@@ -268,10 +267,9 @@ void CombatSystem::e_chooseAttack() {
     startPos = enemy->getPosition();
     targetPos = player->getPosition();
 
-    const auto& attacks = enemy->getAttacks();
-
-    int attackIndex = static_cast<int>(rand() % attacks.size());
-    currentAttack = attacks[attackIndex];
+    currentAttack = CombatRules::chooseAttack(
+        enemy->getAttacks(), Random::stream(RngStream::Combat)
+    );
 
     // apply offset based on attack configuration
     targetPos.x += currentAttack.approachOffset;
@@ -310,10 +308,11 @@ void CombatSystem::processCounter(float dt) {
     turnTimer += dt;
 
     if (counterSuccess && !damageDealt) {
-        enemy->takeDamage(10);
-        spawnDamageText(enemy, 10);
+        enemy->takeDamage(CombatRules::COUNTER_DAMAGE);
+        spawnDamageText(enemy, CombatRules::COUNTER_DAMAGE);
         Logger::info(
-            "Damage dealt: 1, remaining: " + std::to_string(enemy->getHealth())
+            "Counter dealt: " + std::to_string(CombatRules::COUNTER_DAMAGE) +
+            ", remaining: " + std::to_string(enemy->getHealth())
         );
         damageDealt = true;
     }
@@ -323,7 +322,7 @@ void CombatSystem::processCounter(float dt) {
             eState = State::Dead;
             currentState = CombatState::Victory;
             std::cout << "Victory!\n";
-            player->gainExp(5);
+            player->gainExp(CombatRules::VICTORY_EXP);
         } else {
             eState = State::Idle;
             phase = TurnPhase::Returning;
@@ -338,99 +337,73 @@ void CombatSystem::render(
 ) {
 
     // currently set statically... because viewport is set to 900x900
-
-    sf::Sprite backgroundSprite(*currentBackground);
-    backgroundSprite.setPosition({ 0.f, 0.f });
-    target.draw(backgroundSprite);
+    const sf::Vector2u backgroundSize = currentBackground->getSize();
+    spriteBatch.add(
+        *currentBackground,
+        { { 0.f, 0.f }, sf::Vector2f(backgroundSize) },
+        { { 0, 0 }, sf::Vector2i(backgroundSize) }
+    );
 
     // either render player or enemy first based on current combat state
     if (currentState == CombatState::EnemyTurn) {
-        player->draw(target);
-        enemy->draw(target);
+        player->render(spriteBatch);
+        enemy->render(spriteBatch);
     } else {
-        enemy->draw(target);
-        player->draw(target);
+        enemy->render(spriteBatch);
+        player->render(spriteBatch);
     }
 
+    const sf::Texture* button = nullptr;
     if (currentState == CombatState::PlayerTurn && phase == TurnPhase::Input) {
-        if (player->getInventory().hasItemByName("sword")) {
-            sf::Sprite attackButtonSprite(attackButtonTexture);
-            attackButtonSprite.setScale({ 3, 3 });
-            attackButtonSprite.setPosition({ 95.f, 330.f });
-            target.draw(attackButtonSprite);
-        } else {
-            sf::Sprite attackButtonSprite(attackButtonRollTexture);
-            attackButtonSprite.setScale({ 3, 3 });
-            attackButtonSprite.setPosition({ 95.f, 330.f });
-            target.draw(attackButtonSprite);
-        }
+        button = player->getInventory().hasItem(Items::Sword)
+                     ? &attackButtonTexture
+                     : &attackButtonRollTexture;
     }
 
     if (currentAttack.counterable && currentState == CombatState::EnemyTurn &&
         (phase == TurnPhase::Attacking || phase == TurnPhase::Approaching) &&
-        player->getInventory().hasItemByName("counterAttack")) {
-        sf::Sprite counterButtonSprite(counterButtonTexture);
-
-        if (phase == TurnPhase::Attacking &&
-            turnTimer >= currentAttack.counterWindowStart &&
-            turnTimer <= currentAttack.counterWindowEnd) {
-            counterButtonSprite.setTexture(counterButtonGoodTexture);
+        player->getInventory().hasItem(Items::CounterAttack)) {
+        if (phase == TurnPhase::Attacking && attackCursor.isCounterOpen()) {
+            button = &counterButtonGoodTexture;
         } else if (phase == TurnPhase::Attacking &&
-                   turnTimer > currentAttack.counterWindowEnd) {
-            counterButtonSprite.setTexture(counterButtonBadTexture);
+                   attackCursor.hasPassed(AttackEvent::CounterClose)) {
+            button = &counterButtonBadTexture;
         } else {
-            counterButtonSprite.setTexture(counterButtonTexture);
+            button = &counterButtonTexture;
         }
-
-        counterButtonSprite.setScale({ 3, 3 });
-        counterButtonSprite.setPosition({ 95.f, 330.f });
-        target.draw(counterButtonSprite);
     }
-    if (!damageTexts.empty()) {
-        sf::Text tempText(font);
-
-        tempText.setCharacterSize(32);
-        tempText.setOutlineColor(sf::Color::Black);
-        tempText.setOutlineThickness(1.5f);
-        tempText.setStyle(sf::Text::Bold);
-
-        for (const auto& ind : damageTexts) {
-            tempText.setString(ind.text);
-
-            sf::FloatRect bounds = tempText.getLocalBounds();
-            tempText.setOrigin({ bounds.size.x / 2.f, bounds.size.y / 2.f });
-
-            tempText.setPosition(ind.position);
-
-            sf::Color c = ind.color;
-            float alphaRatio = ind.lifeTime / ind.maxLifeTime;
-
-            c.a = static_cast<std::uint8_t>(255 * alphaRatio);
 
-            tempText.setFillColor(c);
-            target.draw(tempText);
-        }
+    if (button != nullptr) {
+        const sf::Vector2u size = button->getSize();
+        spriteBatch.add(
+            *button, { { 95.f, 330.f }, sf::Vector2f(size) * 3.f },
+            { { 0, 0 }, sf::Vector2i(size) }
+        );
     }
+    spriteBatch.draw(target);
+
+    damageIndicators.appendTo(indicatorText, font);
+    indicatorText.draw(target);
 }
 
-void CombatSystem::handleInput(sf::Event& event) {
+void CombatSystem::handleInput(const InputSnapshot& input) {
+    const bool attackPressed = input.isDown(InputAction::CombatAttackPressed);
+    const bool dodgePressed = input.isDown(InputAction::CombatDodgePressed);
+
     if (currentState == CombatState::PlayerTurn && phase == TurnPhase::Input) {
-        if (const auto* keyEvent = event.getIf<sf::Event::KeyPressed>()) {
+        if (attackPressed || dodgePressed) {
             startPos = player->getPosition();
             targetPos = enemy->getPosition();
-            if (keyEvent->code == sf::Keyboard::Key::A) {
-                if (player->getInventory().hasItemByName("sword")) {
-                    currentAttack = { "Attack", 2, State::Attack, 0.3f, 0.8f };
-                    targetPos.x -= 120.f; // close range attack, but still a bit
-                                          // away from the enemy
+            if (attackPressed) {
+                if (player->getInventory().hasItem(Items::Sword)) {
+                    currentAttack =
+                        CombatRules::playerAttack(PlayerAction::Attack);
+                    targetPos.x += currentAttack.approachOffset;
                     phase = TurnPhase::Approaching;
                 }
-            } else if (keyEvent->code == sf::Keyboard::Key::D) {
-                currentAttack = { "Roll", 1,     State::Roll, 0.2f,
-                                  0.85f,  800.f, -90.f,       5.f };
-                targetPos.x -=
-                    340.f; // start roll from further away, therefore our
-                           // targetPos is a bit away from the enemy
+            } else {
+                currentAttack = CombatRules::playerAttack(PlayerAction::Roll);
+                targetPos.x += currentAttack.approachOffset;
                 phase = TurnPhase::Approaching;
             }
         }
@@ -438,40 +411,36 @@ void CombatSystem::handleInput(sf::Event& event) {
                (phase == TurnPhase::Attacking || phase == TurnPhase::Approaching
                ) &&
                currentAttack.counterable) {
-        if (const auto* keyEvent = event.getIf<sf::Event::KeyPressed>()) {
-            if (keyEvent->code == sf::Keyboard::Key::D) {
-                // Check if player has the Counter Attack ability
-                if (!player->getInventory().hasItemByName("counterAttack")) {
-                    return;
-                }
+        if (dodgePressed) {
+            // Check if player has the Counter Attack ability
+            if (!player->getInventory().hasItem(Items::CounterAttack)) {
+                return;
+            }
 
-                if (pState == State::Counter)
-                    return; // prevents spamming (spamming is still possible but
-                            // a bit restricted still with this)
-
-                if (phase == TurnPhase::Attacking &&
-                    turnTimer >= currentAttack.counterWindowStart &&
-                    turnTimer <= currentAttack.counterWindowEnd) {
-                    Logger::info(
-                        "Counter successful for turntimer: " +
-                        std::to_string(turnTimer)
-                    );
-                    counterSuccess = true;
-                    damageDealt = false;
-                    currentState = CombatState::PlayerTurn;
-                    phase = TurnPhase::Countering; // use dedicated phase
-                    turnTimer = 0.0f;
-                    pState = State::Counter;
-                } else {
-                    Logger::info(
-                        "Counter failed for turntimer: " +
-                        std::to_string(turnTimer)
-                    );
-                    counterSuccess = false;
-                    // Just play animation, don't interrupt enemy
-                    pState = State::Counter;
-                    // Player::update will switch back to Idle automatically
-                }
+            if (pState == State::Counter)
+                return; // prevents spamming (spamming is still possible but
+                        // a bit restricted still with this)
+
+            if (phase == TurnPhase::Attacking && attackCursor.isCounterOpen()) {
+                Logger::info(
+                    "Counter successful at: " +
+                    std::to_string(attackCursor.getTime())
+                );
+                counterSuccess = true;
+                damageDealt = false;
+                currentState = CombatState::PlayerTurn;
+                phase = TurnPhase::Countering; // use dedicated phase
+                turnTimer = 0.0f;
+                pState = State::Counter;
+            } else {
+                Logger::info(
+                    "Counter failed at: " +
+                    std::to_string(attackCursor.getTime())
+                );
+                counterSuccess = false;
+                // Just play animation, don't interrupt enemy
+                pState = State::Counter;
+                // Player::update will switch back to Idle automatically
             }
         }
     }
@@ -499,14 +468,5 @@ void CombatSystem::spawnDamageText(Entity* target, int amount) {
     float centerX = box.position.x + (visualWidth / 2.f);
     float topY = box.position.y;
 
-    DamageIndicator indicator;
-    indicator.position = sf::Vector2f{ centerX, topY + 150.f };
-
-    indicator.text = std::to_string(amount * -1);
-    indicator.color = sf::Color::White;
-    indicator.lifeTime = 1.0f;
-    indicator.maxLifeTime = 1.0f;
-    indicator.speed = 100.f;
-
-    damageTexts.push_back(indicator);
+    damageIndicators.spawn({ centerX, topY + 150.f }, amount);
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "joanna/game/combat/combatrules.h"
+
+#include <algorithm>
+
+Combatant CombatRules::player(
+    const int level, const bool hasSword, const bool hasShield
+) {
+    const int levelsGained = std::max(level, 1) - 1;
+    return { PLAYER_HEALTH,
+             BASE_ATTACK + (levelsGained * ATTACK_PER_LEVEL) +
+                 (hasSword ? SWORD_ATTACK : 0),
+             BASE_DEFENSE + (levelsGained * DEFENSE_PER_LEVEL) +
+                 (hasShield ? SHIELD_DEFENSE : 0) };
+}
+
+Combatant CombatRules::enemy(const EnemyDefinition& definition) {
+    return { definition.health, 0, 0 };
+}
+
+Combatant CombatRules::enemy(const EnemyType type) {
+    return enemy(AttackTable::getInstance().getEnemy(type));
+}
+
+const Attack& CombatRules::playerAttack(const PlayerAction action) {
+    return AttackTable::getInstance().getPlayerAttack(action);
+}
+
+const std::vector<Attack>& CombatRules::enemyAttacks(const EnemyType type) {
+    return AttackTable::getInstance().getEnemy(type).attacks;
+}
+
+const Attack&
+CombatRules::chooseAttack(const std::vector<Attack>& attacks, Pcg32& rng) {
+    return attacks[rng.nextBelow(static_cast<std::uint32_t>(attacks.size()))];
+}
+
+int CombatRules::damageToEnemy(const Attack& attack, const int playerAttack) {
+    return std::max(0, attack.damage + playerAttack);
+}
+
+int CombatRules::damageToPlayer(const Attack& attack, const int playerDefense) {
+    return std::max(0, attack.damage - playerDefense);
+}
+
+bool CombatRules::inCounterWindow(const Attack& attack, const float time) {
+    return attack.counterable && time >= attack.counterWindowStart &&
+           time <= attack.counterWindowEnd;
+}
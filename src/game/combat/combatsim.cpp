@@ -0,0 +1,159 @@
+#include "joanna/game/combat/combatsim.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+void count(std::vector<std::uint64_t>& histogram, const int value) {
+    const auto index = static_cast<std::size_t>(std::max(value, 0));
+    if (index >= histogram.size()) {
+        histogram.resize(index + 1, 0);
+    }
+    ++histogram[index];
+}
+
+void addHistogram(
+    std::vector<std::uint64_t>& into, const std::vector<std::uint64_t>& from
+) {
+    if (from.size() > into.size()) {
+        into.resize(from.size(), 0);
+    }
+    for (std::size_t i = 0; i < from.size(); ++i) {
+        into[i] += from[i];
+    }
+}
+
+} // namespace
+
+void FightStats::add(const FightResult& result) {
+    ++fights;
+    wins += result.won ? 1 : 0;
+    duration += result.duration;
+    count(turns, result.turns);
+    count(damageTaken, result.damageTaken);
+}
+
+void FightStats::merge(const FightStats& other) {
+    fights += other.fights;
+    wins += other.wins;
+    duration += other.duration;
+    addHistogram(turns, other.turns);
+    addHistogram(damageTaken, other.damageTaken);
+}
+
+double FightStats::winRate() const {
+    if (fights == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(wins) / static_cast<double>(fights);
+}
+
+double FightStats::meanDuration() const {
+    return fights == 0 ? 0.0 : duration / static_cast<double>(fights);
+}
+
+std::size_t FightStats::percentile(
+    const std::vector<std::uint64_t>& histogram, const double q
+) {
+    std::uint64_t total = 0;
+    for (const std::uint64_t n : histogram) {
+        total += n;
+    }
+    const auto target = static_cast<std::uint64_t>(
+        std::max(1.0, std::ceil(q * static_cast<double>(total)))
+    );
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < histogram.size(); ++i) {
+        seen += histogram[i];
+        if (seen >= target) {
+            return i;
+        }
+    }
+    return histogram.empty() ? 0 : histogram.size() - 1;
+}
+
+double FightStats::mean(const std::vector<std::uint64_t>& histogram) {
+    std::uint64_t total = 0;
+    double sum = 0.0;
+    for (std::size_t i = 0; i < histogram.size(); ++i) {
+        total += histogram[i];
+        sum += static_cast<double>(i) * static_cast<double>(histogram[i]);
+    }
+    return total == 0 ? 0.0 : sum / static_cast<double>(total);
+}
+
+FightResult CombatSim::fight(const FightSetup& setup, Pcg32& rng) {
+    return fight(setup, AttackTable::getInstance().getEnemy(setup.enemy), rng);
+}
+
+FightResult CombatSim::fight(
+    const FightSetup& setup, const EnemyDefinition& definition, Pcg32& rng
+) {
+    Combatant player =
+        CombatRules::player(setup.level, setup.hasSword, setup.hasShield);
+    Combatant enemy = CombatRules::enemy(definition);
+    const std::vector<Attack>& enemyAttacks = definition.attacks;
+    const Attack& playerAttack = CombatRules::playerAttack(
+        setup.hasSword ? PlayerAction::Attack : PlayerAction::Roll
+    );
+
+    FightResult result;
+    const auto hitEnemy = [&](const int damage) {
+        enemy.health = std::max(enemy.health - damage, 0);
+        result.damageDealt += damage;
+    };
+    const auto hitPlayer = [&](const int damage) {
+        player.health = std::max(player.health - damage, 0);
+        result.damageTaken += damage;
+    };
+
+    while (result.turns < MAX_TURNS) {
+        // player turn
+        ++result.turns;
+        hitEnemy(CombatRules::damageToEnemy(playerAttack, player.attack));
+        result.duration += playerAttack.endTime;
+        if (enemy.isDead()) {
+            result.won = true;
+            break;
+        }
+
+        // enemy turn, the attack lands at impact unless countered before
+        ++result.turns;
+        const Attack& attack = CombatRules::chooseAttack(enemyAttacks, rng);
+        const int damage = CombatRules::damageToPlayer(attack, player.defense);
+        if (setup.canCounter && attack.counterable &&
+            rng.chance(setup.counterSkill)) {
+            const float pressed =
+                rng.range(attack.counterWindowStart, attack.counterWindowEnd);
+            if (pressed >= attack.impactTime) {
+                hitPlayer(damage);
+            }
+            hitEnemy(CombatRules::COUNTER_DAMAGE);
+            result.duration += pressed + attack.counterWindowEnd;
+            if (enemy.isDead()) {
+                result.won = true;
+                break;
+            }
+        } else {
+            hitPlayer(damage);
+            result.duration += attack.endTime;
+        }
+        if (player.isDead()) {
+            break;
+        }
+    }
+    return result;
+}
+
+FightStats CombatSim::run(
+    const FightSetup& setup, const std::uint64_t fights, Pcg32& rng
+) {
+    const EnemyDefinition& definition =
+        AttackTable::getInstance().getEnemy(setup.enemy);
+    FightStats stats;
+    for (std::uint64_t i = 0; i < fights; ++i) {
+        stats.add(fight(setup, definition, rng));
+    }
+    return stats;
+}
@@ -0,0 +1,77 @@
+#include "joanna/game/combat/damageindicators.h"
+
+#include <charconv>
+#include <string_view>
+
+namespace {
+TextStyle indicatorStyle() {
+    TextStyle style;
+    style.size = 32;
+    style.outlineThickness = 1.5f;
+    style.bold = true;
+    return style;
+}
+} // namespace
+
+void DamageIndicatorPool::spawn(
+    const sf::Vector2f position, const int amount, const sf::Color color,
+    const float lifeTime, const float speed
+) {
+    if (count == CAPACITY) {
+        head = (head + 1) % CAPACITY; // drop the oldest
+        --count;
+    }
+    Indicator& indicator = ring.at((head + count) % CAPACITY);
+    ++count;
+
+    indicator.position = position;
+    indicator.color = color;
+    indicator.lifeTime = lifeTime;
+    indicator.maxLifeTime = lifeTime;
+    indicator.speed = speed;
+    const auto result = std::to_chars(
+        indicator.text.data(), indicator.text.data() + indicator.text.size(),
+        -amount
+    );
+    indicator.length =
+        static_cast<std::uint8_t>(result.ptr - indicator.text.data());
+}
+
+void DamageIndicatorPool::update(const float dt) {
+    for (std::size_t i = 0; i < count; ++i) {
+        Indicator& indicator = ring.at((head + i) % CAPACITY);
+        indicator.lifeTime -= dt;
+        indicator.position.y -= indicator.speed * dt;
+    }
+    // spawned in order, so the oldest expire first
+    while (count > 0 && ring.at(head).lifeTime <= 0.f) {
+        head = (head + 1) % CAPACITY;
+        --count;
+    }
+}
+
+void DamageIndicatorPool::clear() {
+    head = 0;
+    count = 0;
+}
+
+void DamageIndicatorPool::appendTo(TextBatch& batch, const sf::Font& font)
+    const {
+    static const TextStyle style = indicatorStyle();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Indicator& indicator = at(i);
+        if (indicator.lifeTime <= 0.f) {
+            continue; // a longer lived one in front keeps it in the ring
+        }
+        const TextLayout& layout = TextCache::getInstance().get(
+            font, std::string_view(indicator.text.data(), indicator.length),
+            style
+        );
+        sf::Color color = indicator.color;
+        color.a = static_cast<std::uint8_t>(
+            255 * (indicator.lifeTime / indicator.maxLifeTime)
+        );
+        const sf::Vector2f origin = layout.bounds.size / 2.f;
+        batch.add(font, style, layout, indicator.position - origin, color);
+    }
+}
@@ -1,27 +1,35 @@
 #include "joanna/entities/inventory.h"
 
+#include "joanna/utils/quads.h"
 #include "joanna/utils/resourcemanager.h"
-#include "joanna/world/tilemanager.h"
 
 #include <algorithm>
 #include <utility>
 
 #include "joanna/core/savegamemanager.h"
 
-Item::Item(std::string id, std::string name, const bool stackable)
-    : id(std::move(id)), name(std::move(name)), stackable(stackable) {}
+Item::Item(const ItemId id)
+    : id(id), stackable(ItemRegistry::getInstance().get(id).stackable) {}
+
+Item::Item(const ItemId id, const bool stackable)
+    : id(id), stackable(stackable) {}
+
+const ItemDefinition& Item::definition() const {
+    return ItemRegistry::getInstance().get(id);
+}
 
 StoredItem::StoredItem(Item item, const std::uint32_t q)
     : item(std::move(item)), quantity(q) {}
 
 Inventory::Inventory(const std::size_t capacity) : capacity_(capacity) {
-    font = ResourceManager<sf::Font>::getInstance()->get(
+    font = &ResourceManager<sf::Font>::getInstance()->get(
         "assets/font/minecraft.ttf"
     );
+    iconAtlas = &ResourceManager<sf::Texture>::getInstance()->get(
+        "assets/environment/map/tileset.png"
+    );
 }
 
-
-
 /**
  * Adds an item to the inventory. If the item is stackable and already exists,
  * it will increase the quantity. Otherwise, it will add a new entry if there
@@ -37,72 +45,69 @@ Inventory::addItem(const Item& item, const std::uint32_t quantity) {
     }
     const std::size_t usedSlots = items_.size();
 
-    auto map = mapGidToName();
-    const auto iterator = map.find(std::stoi(item.id));
-    auto name = item.name;
-    if (iterator != map.end()) {
-        name = iterator->second;
-    }
-
-    auto item_new = Item(item.id, name, item.stackable);
-
-    if (item.stackable) {
-        const auto it = std::find_if(
-            items_.begin(), items_.end(),
-            [&](const StoredItem& si) { return si.item.id == item_new.id; }
-        );
-
-        if (it != items_.end()) {
-            it->quantity += quantity;
-            return quantity;
-        }
+    if (item.stackable && item.id < firstSlot.size() &&
+        firstSlot[item.id] != NO_SLOT) {
+        items_[firstSlot[item.id]].quantity += quantity;
+        changeQuantity(item.id, quantity, 0);
+        return quantity;
     }
 
     if (usedSlots + 1 > capacity_) {
         return 0;
     }
 
-    const auto it = std::find_if(
-        items_.begin(), items_.end(),
-        [this](const StoredItem& itemLambda) {
-            return isItemInvisible(std::stoi(itemLambda.item.id));
-        }
+    // visible items go in front of the invisible ones
+    const std::size_t slot =
+        isItemInvisible(item) ? items_.size() : firstInvisibleSlot;
+    items_.insert(
+        items_.begin() + static_cast<std::ptrdiff_t>(slot),
+        StoredItem(item, quantity)
     );
-
-    if (it != items_.end()) {
-        items_.insert(it, StoredItem(item_new, quantity));
-        return quantity;
-    }
-    items_.emplace_back(item_new, quantity);
+    changeQuantity(item.id, quantity, 0);
+    reindexSlots();
     return quantity;
 }
 
 /**
- * Removes a specified quantity of an item from the inventory. If the quantity
- * to remove exceeds what's available, it will remove as much as possible. Returns
- * the actual quantity removed.
+ * Removes a specified quantity of an item from the inventory, draining the
+ * slots holding it in order. If the quantity to remove exceeds what's
+ * available, it will remove as much as possible. Returns the actual quantity
+ * removed.
  */
 std::uint32_t
-Inventory::removeItem(const std::string& id, const std::uint32_t quantity) {
+Inventory::removeItem(const ItemId id, const std::uint32_t quantity) {
     if (quantity == 0) {
         return 0;
     }
 
-    const auto it =
-        std::find_if(items_.begin(), items_.end(), [&](const StoredItem& si) {
-            return si.item.id == id;
-        });
-
-    if (it == items_.end()) {
+    if (id >= firstSlot.size() || firstSlot[id] == NO_SLOT) {
         return 0;
     }
 
-    const std::uint32_t removed = std::min<uint32_t>(it->quantity, quantity);
-
-    it->quantity -= removed;
-
-    if (it->quantity == 0) {
-        items_.erase(it);
+    std::uint32_t removed = 0;
+    bool emptied = false;
+    for (auto it = items_.begin() + firstSlot[id];
+         it != items_.end() && removed < quantity; ++it) {
+        if (it->item.id != id) {
+            continue;
+        }
+        const std::uint32_t taken =
+            std::min<std::uint32_t>(it->quantity, quantity - removed);
+        it->quantity -= taken;
+        removed += taken;
+        emptied = emptied || it->quantity == 0;
+    }
+    changeQuantity(id, 0, removed);
+
+    if (emptied) {
+        items_.erase(
+            std::remove_if(
+                items_.begin(), items_.end(),
+                [](const StoredItem& si) { return si.quantity == 0; }
+            ),
+            items_.end()
+        );
+        reindexSlots();
 
         // Safety check
         if (selectedSlotIndex >= items_.size() && !items_.empty()) {
@@ -118,36 +123,57 @@ Inventory::removeItem(const std::string& id, const std::uint32_t quantity) {
 /**
  * Checks if the inventory contains at least one unit of the specified item ID.
  */
-bool Inventory::hasItem(const std::string& id) const {
-    const auto it =
-        std::find_if(items_.begin(), items_.end(), [&](const StoredItem& si) {
-            return si.item.id == id;
-        });
-    return it != items_.end();
-}
-
-/**
- * Checks if the inventory contains at least one unit of the specified item name.
- */
-bool Inventory::hasItemByName(const std::string& name) const {
-    const auto it =
-        std::find_if(items_.begin(), items_.end(), [&](const StoredItem& si) {
-            return si.item.name == name;
-        });
-    return it != items_.end();
+bool Inventory::hasItem(const ItemId id) const {
+    if (id < FLAG_COUNT) {
+        return flags.test(id);
+    }
+    return getQuantity(id) > 0;
 }
 
 /**
  * Retrieves the quantity of a specific item in the inventory by its ID. Returns
  * 0 if the item is not found.
  */
-std::uint32_t Inventory::getQuantity(const std::string& id) const {
-    const auto it =
-        std::find_if(items_.begin(), items_.end(), [&](const StoredItem& si) {
-            return si.item.id == id;
-        });
+std::uint32_t Inventory::getQuantity(const ItemId id) const {
+    return id < quantities.size() ? quantities[id] : 0u;
+}
+
+void Inventory::changeQuantity(
+    const ItemId id, const std::uint32_t added, const std::uint32_t removed
+) {
+    if (id >= quantities.size()) {
+        quantities.resize(id + 1, 0);
+    }
+    quantities[id] = quantities[id] + added - removed;
+    panelDirty = true;
+    if (id < FLAG_COUNT) {
+        flags.set(id, quantities[id] > 0);
+    }
+}
 
-    return (it == items_.end()) ? 0u : it->quantity;
+void Inventory::reindexSlots() {
+    std::fill(firstSlot.begin(), firstSlot.end(), NO_SLOT);
+    firstInvisibleSlot = items_.size();
+    for (std::size_t i = items_.size(); i-- > 0;) {
+        const Item& item = items_[i].item;
+        if (item.id >= firstSlot.size()) {
+            firstSlot.resize(item.id + 1, NO_SLOT);
+        }
+        firstSlot[item.id] = static_cast<std::uint32_t>(i);
+        if (isItemInvisible(item)) {
+            firstInvisibleSlot = i;
+        }
+    }
+}
+
+void Inventory::rebuildIndex() {
+    quantities.clear();
+    flags.reset();
+    for (const auto& si : items_) {
+        changeQuantity(si.item.id, si.quantity, 0);
+    }
+    reindexSlots();
+    panelDirty = true;
 }
 
 /**
@@ -165,13 +191,27 @@ const std::vector<StoredItem>& Inventory::listItems() const {
 /**
  * Load the inventory state from the saved game data.
  */
-void Inventory::loadState(InventoryState& state) {
+void Inventory::loadState(const InventoryState& state) {
+    auto& registry = ItemRegistry::getInstance();
     items_.clear();
     items_.reserve(state.items.size());
-    for (auto& [id, quantity] : state.items) {
-        Item item(id, idToString.at(std::stoi(id)));
-        items_.emplace_back(item, quantity);
+    for (const auto& [id, quantity] : state.items) {
+        items_.emplace_back(Item(registry.fromString(id)), quantity);
     }
+    rebuildIndex();
+}
+
+/**
+ * Snapshot of the inventory for the save file, items are stored by gid.
+ */
+InventoryState Inventory::saveState() const {
+    const auto& registry = ItemRegistry::getInstance();
+    InventoryState state;
+    state.items.reserve(items_.size());
+    for (const auto& si : items_) {
+        state.items.push_back({ registry.toString(si.item.id), si.quantity });
+    }
+    return state;
 }
 
 /**
@@ -180,6 +220,7 @@ void Inventory::loadState(InventoryState& state) {
 void Inventory::clear() {
     items_.clear();
     selectedSlotIndex = 0;
+    rebuildIndex();
 }
 
 void Inventory::setCapacity(const std::size_t cap) {
@@ -205,167 +246,159 @@ void Inventory::draw(sf::RenderTarget& target) const {
                          std::to_string(capacity()) + ")\n";
         for (const auto& si : items) {
             inventoryText +=
-                si.item.name + " x" + std::to_string(si.quantity) + "\n";
+                si.item.name() + " x" + std::to_string(si.quantity) + "\n";
         }
     }
 
-    sf::Text text(font);
-    text.setString(inventoryText);
-    text.setCharacterSize(14);
-    text.setFillColor(sf::Color::White);
-    text.setPosition({ 0, 0 });
+    TextStyle style;
+    style.size = 14;
     const auto view = target.getView();
     target.setView(target.getDefaultView());
-    target.draw(text);
+    textBatch.add(
+        *font, style, TextCache::getInstance().get(*font, inventoryText, style),
+        { 0.f, 0.f }, sf::Color::White
+    );
+    textBatch.draw(target);
     target.setView(view);
 }
 
-void Inventory::drawSlot(
-    sf::RenderTarget& target, const float slotSize, const float padding,
-    const sf::Vector2f startPos, std::size_t i, std::size_t col,
-    const std::size_t row, sf::Vector2f& slotPos, bool isSelected
-) const {
-    slotPos = { startPos.x + (static_cast<float>(col) * (slotSize + padding)),
-                startPos.y + (static_cast<float>(row) * (slotSize + padding)) };
-
-    sf::RectangleShape slot({ slotSize, slotSize });
-    slot.setPosition(slotPos);
-
-    // Highlight selected slot
-    if (isSelected) {
-        slot.setFillColor(sf::Color(70, 70, 70, 220));
-        slot.setOutlineThickness(2.f);
-        slot.setOutlineColor(sf::Color(200, 200, 50, 220));
-    } else {
-        slot.setFillColor(sf::Color(40, 40, 40, 200));
-        slot.setOutlineThickness(1.f);
-        slot.setOutlineColor(sf::Color(120, 120, 120, 200));
-    }
-    target.draw(slot);
-}
-
 void Inventory::drawItemName(
-    sf::RenderTarget& target, const float slotSize, const sf::Vector2f slotPos,
+    TextBatch& batch, const float slotSize, const sf::Vector2f slotPos,
     const StoredItem& st
 ) const {
-    sf::Text name(font);
-    name.setString(st.item.name);
-    name.setCharacterSize(14);
-    name.setFillColor(sf::Color::White);
-
-    sf::FloatRect tb = name.getLocalBounds();
-    name.setOrigin({ tb.position.x + (tb.size.x / 2.f), tb.position.y });
-    name.setPosition({ slotPos.x + (slotSize / 2.f), slotPos.y + 4.f });
-
-    target.draw(name);
+    TextStyle style;
+    style.size = 14;
+    const TextLayout& name =
+        TextCache::getInstance().get(*font, st.item.name(), style);
+
+    const sf::FloatRect tb = name.bounds;
+    const sf::Vector2f origin(tb.position.x + (tb.size.x / 2.f), tb.position.y);
+    batch.add(
+        *font, style, name,
+        sf::Vector2f(slotPos.x + (slotSize / 2.f), slotPos.y + 4.f) - origin,
+        sf::Color::White
+    );
 }
 
 void Inventory::drawItemQuantity(
-    sf::RenderTarget& target, const float slotSize, const sf::Vector2f slotPos,
+    TextBatch& batch, const float slotSize, const sf::Vector2f slotPos,
     const StoredItem& st
 ) const {
     if (st.quantity > 1) {
-        sf::Text qText(font);
-        qText.setString(std::to_string(st.quantity));
-        qText.setCharacterSize(16);
-        sf::Text shadow = qText;
-
-        qText.setFillColor(sf::Color::White);
-        shadow.setFillColor(sf::Color(0, 0, 0, 200));
+        TextStyle style;
+        style.size = 16;
+        const TextLayout& qText = TextCache::getInstance().get(
+            *font, std::to_string(st.quantity), style
+        );
 
-        const sf::FloatRect qb = qText.getLocalBounds();
+        const sf::FloatRect qb = qText.bounds;
         const sf::Vector2f pos({ slotPos.x + slotSize - qb.size.y - 6.f -
                                qb.position.y,
                            slotPos.y + slotSize - qb.size.x - 6.f });
 
-        shadow.setPosition(pos + sf::Vector2f(1.f, 1.f));
-        qText.setPosition(pos);
-
-        target.draw(shadow);
-        target.draw(qText);
+        batch.add(
+            *font, style, qText, pos + sf::Vector2f(1.f, 1.f),
+            sf::Color(0, 0, 0, 200)
+        );
+        batch.add(*font, style, qText, pos, sf::Color::White);
     }
 }
 
-void Inventory::drawItemSprite(
-    sf::RenderTarget& target, TileManager& tileManager, const float slotSize,
-    const sf::Vector2f slotPos, const StoredItem& st
+void Inventory::appendItemIcon(
+    const float slotSize, const sf::Vector2f slotPos, const StoredItem& st
 ) const {
-    sf::Sprite icon = tileManager.getTextureById(std::stoi(st.item.id));
+    const sf::IntRect rect = st.item.definition().iconRect;
+    const float scale = (slotSize * 0.5f) / static_cast<float>(rect.size.x);
+    const sf::Vector2f size(
+        static_cast<float>(rect.size.x) * scale,
+        static_cast<float>(rect.size.y) * scale
+    );
+    const sf::Vector2f center(
+        slotPos.x + ((slotSize - scale) / 2.f),
+        slotPos.y + ((slotSize - scale) / 2.f) + 8.f
+    );
+    appendQuad(
+        iconVertices, { center - (size / 2.f), size }, sf::Color::White,
+        sf::FloatRect(rect)
+    );
+}
 
-    const auto bounds = icon.getLocalBounds();
-    const float targetSize = slotSize * 0.5f;
-    float scale = targetSize / bounds.size.x; // assuming square icon
+void Inventory::rebuildPanel(const sf::Vector2f viewCenter) const {
+    constexpr std::size_t columns = 8;
+    constexpr float slotSize = 64.f;
+    constexpr float padding = 6.f;
 
-    icon.setScale({ scale, scale });
-    icon.setPosition({ slotPos.x + ((slotSize - (scale)) / 2.f),
-                       slotPos.y + ((slotSize - (scale)) / 2.f) + 8.f });
-    target.draw(icon);
-}
+    panelVertices.clear();
+    iconVertices.clear();
+    panelLabels.clear();
+
+    const std::size_t itemCount = firstInvisibleSlot;
+    const std::size_t rows =
+        std::max<std::size_t>(1, (itemCount - 1 + columns) / columns);
+    constexpr float totalWidth =
+        (columns * slotSize) + (padding * (columns - 1)) + (2 * padding);
+    const float totalHeight = (static_cast<float>(rows) * slotSize) +
+                              (padding * (static_cast<float>(rows) - 1)) +
+                              (2 * padding);
+    const sf::Vector2f startPos(viewCenter.x - (totalWidth / 2.f), 360.f);
+
+    // Outer background
+    appendOutlinedRect(
+        panelVertices,
+        { startPos - sf::Vector2f(padding, padding),
+          { totalWidth, totalHeight } },
+        sf::Color(25, 25, 25, 200), sf::Color(180, 180, 180, 120), 1.f
+    );
 
-void Inventory::drawItems(
-    sf::RenderTarget& target, TileManager& tileManager,
-    std::vector<StoredItem> vec, const std::size_t columns,
-    const float slotSize, const float padding, const std::size_t itemCount,
-    const sf::Vector2f startPos
-) const {
     for (std::size_t i = 0; i < itemCount; ++i) {
         const std::size_t col = i % columns;
         const std::size_t row = i / columns;
-
-        if (isItemInvisible(std::stoi(vec.at(i).item.id))) {
-            continue;
-        }
-
-        sf::Vector2f slotPos;
-        StoredItem& st = vec.at(i);
-        const bool isSelected = (i == this->selectedSlotIndex);
-
-        drawSlot(
-            target, slotSize, padding, startPos, i, col, row, slotPos,
-            isSelected
+        const sf::Vector2f slotPos(
+            startPos.x + (static_cast<float>(col) * (slotSize + padding)),
+            startPos.y + (static_cast<float>(row) * (slotSize + padding))
         );
-        drawItemName(target, slotSize, slotPos, st);
-        drawItemQuantity(target, slotSize, slotPos, st);
-        drawItemSprite(target, tileManager, slotSize, slotPos, st);
+        const StoredItem& st = items_[i];
+
+        // Highlight selected slot
+        if (i == selectedSlotIndex) {
+            appendOutlinedRect(
+                panelVertices, { slotPos, { slotSize, slotSize } },
+                sf::Color(70, 70, 70, 220), sf::Color(200, 200, 50, 220), 2.f
+            );
+        } else {
+            appendOutlinedRect(
+                panelVertices, { slotPos, { slotSize, slotSize } },
+                sf::Color(40, 40, 40, 200), sf::Color(120, 120, 120, 200),
+                1.f
+            );
+        }
+        drawItemName(panelLabels, slotSize, slotPos, st);
+        drawItemQuantity(panelLabels, slotSize, slotPos, st);
+        appendItemIcon(slotSize, slotPos, st);
     }
-}
 
-void Inventory::displayInventory(
-    sf::RenderTarget& target, TileManager& tileManager
-) const {
+    panelCenter = viewCenter;
+    panelDirty = false;
+}
 
-    const auto& vec = items_;
+void Inventory::displayInventory(sf::RenderTarget& target) const {
+    const sf::Vector2f center = target.getView().getCenter();
+    if (panelDirty || center != panelCenter) {
+        rebuildPanel(center);
+    }
 
-    constexpr std::size_t columns = 8;
-    constexpr float slotSize = 64.f;
-    constexpr float padding = 6.f;
-    // Outer background
-    const std::size_t itemCount =
-        std::count_if(vec.begin(), vec.end(), [this](const StoredItem& item) {
-            return !isItemInvisible(std::stoi(item.item.id));
-        });
-    const std::size_t rows =
-        std::max<std::size_t>(1, (itemCount - 1 + columns) / columns);
-    constexpr float totalWidth =
-        (columns * slotSize) + (padding * (columns - 1)) + (2 * padding);
-    const float totalHeight = (static_cast<float>(rows) * slotSize) +
-                        (padding * (static_cast<float>(rows) - 1)) +
-                        (2 * padding);
-
-    const auto center = target.getView().getCenter();
-    const sf::Vector2f startPos(center.x - (totalWidth / 2.f), 360.f);
-
-    sf::RectangleShape bg({ totalWidth, totalHeight });
-    bg.setPosition(startPos - sf::Vector2f(padding, padding));
-    bg.setFillColor(sf::Color(25, 25, 25, 200));
-    bg.setOutlineThickness(1.f);
-    bg.setOutlineColor(sf::Color(180, 180, 180, 120));
-    target.draw(bg);
-
-    drawItems(
-        target, tileManager, vec, columns, slotSize, padding, itemCount,
-        startPos
+    target.draw(
+        panelVertices.data(), panelVertices.size(),
+        sf::PrimitiveType::Triangles
     );
+    sf::RenderStates states;
+    states.texture = iconAtlas;
+    target.draw(
+        iconVertices.data(), iconVertices.size(), sf::PrimitiveType::Triangles,
+        states
+    );
+    // labels on top of the icons
+    panelLabels.draw(target, true);
 }
 
 void Inventory::selectNext() {
@@ -377,6 +410,7 @@ void Inventory::selectNext() {
         selectedSlotIndex = 0;
     }
     checkInventoryInvisibleBounds();
+    panelDirty = true;
 }
 
 void Inventory::selectSlot(std::size_t index) {
@@ -388,6 +422,7 @@ void Inventory::selectSlot(std::size_t index) {
         selectedSlotIndex = 0;
     }
     checkInventoryInvisibleBounds();
+    panelDirty = true;
 }
 
 void Inventory::selectPrevious() {
@@ -395,50 +430,27 @@ void Inventory::selectPrevious() {
         return;
     }
     if (selectedSlotIndex == 0) {
-        const auto it = std::find_if(
-            items_.begin(), items_.end(),
-            [this](const StoredItem& item) {
-                return isItemInvisible(std::stoi(item.item.id));
-            }
-        );
-        selectedSlotIndex = std::distance(items_.begin(), it) - 1;
+        selectedSlotIndex = firstInvisibleSlot - 1;
     } else {
         selectedSlotIndex--;
     }
+    panelDirty = true;
 }
 
 int Inventory::getSelectedSlotIndex() const {
     return static_cast<int>(selectedSlotIndex);
 }
 
-std::string Inventory::getSelectedItemId() const {
-    try {
-        auto item = listItems().at(getSelectedSlotIndex());
-        return item.item.id;
-    } catch (const std::out_of_range&) {
-        return "";
+ItemId Inventory::getSelectedItemId() const {
+    if (selectedSlotIndex >= items_.size()) {
+        return NO_ITEM;
     }
+    return items_[selectedSlotIndex].item.id;
 }
 
 void Inventory::checkInventoryInvisibleBounds() {
-    const auto it = std::find_if(
-        items_.begin(), items_.end(),
-        [this](const StoredItem& item) {
-            return isItemInvisible(std::stoi(item.item.id));
-        }
-    );
-    if (it != items_.end()) {
-        if (const std::size_t index = std::distance(items_.begin(), it);
-            selectedSlotIndex >= index) {
-            if (selectedSlotIndex >= index) {
-                selectedSlotIndex = 0;
-            }
-        }
+    if (firstInvisibleSlot < items_.size() &&
+        selectedSlotIndex >= firstInvisibleSlot) {
+        selectedSlotIndex = 0;
     }
 }
-
-bool Inventory::isItemInvisible(const int itemId) const {
-    return std::find(
-               invisibleItemIds.begin(), invisibleItemIds.end(), itemId
-           ) != invisibleItemIds.end();
-}
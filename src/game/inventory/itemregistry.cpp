@@ -0,0 +1,63 @@
+#include "joanna/entities/itemregistry.h"
+
+#include <utility>
+
+ItemRegistry& ItemRegistry::getInstance() {
+    static ItemRegistry instance;
+    return instance;
+}
+
+ItemRegistry::ItemRegistry() {
+    // order must match the constants in the Items namespace
+    add({ 691, "carrot" });
+    add({ 3050, "sword" });
+    add({ 3056, "piratToken", true, true });
+    add({ 3055, "counterAttack", true, true });
+    add({ 627, "key" });
+    add({ 628, "bone" });
+    add({ 629, "shield" });
+    add({ 630, "grade" });
+    add({ 703, "mushroom" });
+    add({ 1330, "heal" });
+    add({ 3113, "pickaxe" });
+}
+
+ItemId ItemRegistry::add(ItemDefinition definition) {
+    const auto id = static_cast<ItemId>(definitions.size());
+    definition.iconRect = tileRect(definition.gid);
+    byGid.emplace(definition.gid, id);
+    definitions.push_back(std::move(definition));
+    return id;
+}
+
+ItemId ItemRegistry::intern(const std::uint32_t gid, std::string_view name) {
+    if (const auto it = byGid.find(gid); it != byGid.end()) {
+        return it->second;
+    }
+    ItemDefinition definition;
+    definition.gid = gid;
+    definition.name = name.empty() ? std::to_string(gid) : std::string(name);
+    return add(std::move(definition));
+}
+
+std::optional<ItemId> ItemRegistry::findByGid(const std::uint32_t gid) const {
+    if (const auto it = byGid.find(gid); it != byGid.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::string ItemRegistry::toString(const ItemId id) const {
+    return std::to_string(get(id).gid);
+}
+
+ItemId ItemRegistry::fromString(const std::string& gidText) {
+    return intern(static_cast<std::uint32_t>(std::stoul(gidText)));
+}
+
+sf::IntRect ItemRegistry::tileRect(const std::uint32_t gid) {
+    const int index = static_cast<int>(gid);
+    return { { (index % TILESET_COLUMNS) * TILE_SIZE,
+               (index / TILESET_COLUMNS) * TILE_SIZE },
+             { TILE_SIZE, TILE_SIZE } };
+}
@@ -0,0 +1,77 @@
+#include "joanna/systems/aischeduler.h"
+
+#include <algorithm>
+
+void AIScheduler::beginFrame(
+    const sf::FloatRect& view, sf::Vector2f playerPos
+) {
+    this->view = view;
+    this->playerPos = playerPos;
+    ++frame;
+    sightChecks = 0;
+}
+
+AiTier AIScheduler::classify(sf::Vector2f position) const {
+    const sf::Vector2f delta = position - playerPos;
+    const float distSq = (delta.x * delta.x) + (delta.y * delta.y);
+
+    if (view.contains(position) ||
+        distSq < config.activeRadius * config.activeRadius) {
+        return AiTier::Active;
+    }
+    if (distSq < config.dormantRadius * config.dormantRadius) {
+        return AiTier::Background;
+    }
+    return AiTier::Dormant;
+}
+
+AiTick AIScheduler::schedule(
+    std::uint32_t id, sf::Vector2f position, float dt
+) {
+    Slot& slot = slots[id];
+    AiTick tick;
+    tick.tier = classify(position);
+    tick.visible = view.contains(position);
+
+    slot.pendingDt = std::min(slot.pendingDt + dt, config.maxCatchUp);
+
+    if (tick.tier == AiTier::Dormant) {
+        tick.run = false;
+        return tick;
+    }
+
+    // stagger background actors by id so they do not all land on one frame
+    if (tick.tier == AiTier::Background) {
+        const auto interval =
+            static_cast<std::uint64_t>(std::max(config.backgroundInterval, 1));
+        if ((frame + id) % interval != 0) {
+            tick.run = false;
+            return tick;
+        }
+    }
+
+    tick.dt = slot.pendingDt;
+    slot.pendingDt = 0.f;
+
+    // stale results are refreshed while the budget lasts, actors that miss
+    // out stay stale and try again next frame
+    const bool stale =
+        !slot.hasSight ||
+        frame - slot.lastSightFrame >=
+            static_cast<std::uint64_t>(config.sightInterval);
+    tick.refreshSight = stale && sightChecks < config.sightBudget;
+    if (tick.refreshSight) {
+        ++sightChecks;
+        slot.lastSightFrame = frame;
+        slot.hasSight = true;
+    }
+    return tick;
+}
+
+void AIScheduler::forget(std::uint32_t id) {
+    slots.erase(id);
+}
+
+void AIScheduler::clear() {
+    slots.clear();
+}
@@ -1,128 +1,82 @@
 #include "joanna/systems/audiomanager.h"
-#include "joanna/utils/logger.h"
-#include "joanna/utils/resourcemanager.h"
-#include <SFML/Audio.hpp>
-
-AudioManager::AudioManager() : sfx_volume_(100.0f), music_volume_(30.0f) {
-
-    auto* buffer_manager = ResourceManager<sf::SoundBuffer>::getInstance();
-
-    constexpr std::array<SfxId, 9> all_sfx = { SfxId::Hit,     SfxId::Footstep,
-                                               SfxId::Dead,    SfxId::Surprise,
-                                               SfxId::Collect, SfxId::Damage,
-                                               SfxId::Click,   SfxId::Break,
-                                               SfxId::Chest };
-
-    for (size_t i = 0; i < all_sfx.size(); ++i) {
-        try {
-            sf::SoundBuffer& buffer =
-                buffer_manager->get(get_sfx_path(all_sfx.at(i)));
-            sounds_.at(i) = std::make_unique<sf::Sound>(buffer);
-            sounds_.at(i)->setVolume(sfx_volume_);
-        } catch (const std::exception& e) {
-            Logger::error("Failed to load sound effect: {}", e.what());
-        }
-    }
-}
-
-std::string AudioManager::get_sfx_path(SfxId sfx_id) const {
-    switch (sfx_id) {
-        case SfxId::Hit:
-            return "assets/sfx/hit_.wav";
-        case SfxId::Click:
-            return "assets/sfx/click.wav";
-        case SfxId::Footstep:
-            return "assets/sfx/footstep.wav";
-        case SfxId::Dead:
-            return "assets/sfx/dead.wav";
-        case SfxId::Surprise:
-            return "assets/sfx/surprise.wav";
-        case SfxId::Collect:
-            return "assets/sfx/collect.wav";
-        case SfxId::Damage:
-            return "assets/sfx/damage.wav";
-        case SfxId::Break:
-            return "assets/sfx/break.wav";
-        case SfxId::Chest:
-            return "assets/sfx/chest.wav";
-        default:
-            throw std::invalid_argument("Invalid SfxId");
-    }
-}
-
-std::string AudioManager::get_music_path(MusicId music_id) const {
-    switch (music_id) {
-        case MusicId::Overworld:
-            return "assets/music/overworld.ogg";
-        case MusicId::Underworld:
-            return "assets/music/underworld.ogg";
-        case MusicId::Beach:
-            return "assets/music/beach.ogg";
-        case MusicId::Combat:
-            return "assets/music/combat.ogg";
-        case MusicId::GameOver:
-            return "assets/music/game_over.ogg";
-        default:
-            throw std::invalid_argument("Invalid MusicId");
-    }
+
+#include <algorithm>
+
+AudioManager::AudioManager()
+    : sfx_(std::make_unique<SfxPlayer>()),
+      music_(std::make_unique<MusicPlayer>()), sfx_volume_(100.0f),
+      music_volume_(30.0f) {
+    sfx_->setVolume(sfx_volume_);
+    music_->setVolume(music_volume_);
 }
 
 void AudioManager::play_sfx(SfxId sfx_id) {
-    auto index = static_cast<size_t>(sfx_id);
-    if (index < 9 && sounds_.at(index)) {
-        sounds_.at(index)->play();
-    } else {
-        Logger::error("Sound effect not loaded: {}", static_cast<int>(sfx_id));
-    }
+    sfx_->trigger(sfx_id);
+}
+
+void AudioManager::play_sfx(SfxId sfx_id, sf::Vector2f position) {
+    sfx_->trigger(sfx_id, position);
+}
+
+void AudioManager::play_sfx(SoundId sound_id) {
+    sfx_->trigger(sound_id);
+}
+
+void AudioManager::play_sfx(SoundId sound_id, sf::Vector2f position) {
+    sfx_->trigger(sound_id, position);
+}
+
+SoundId AudioManager::find_sfx(std::string_view name) {
+    return AudioManifest::getInstance().find(name);
+}
+
+void AudioManager::set_listener_position(sf::Vector2f position) {
+    sfx_->setListener(position);
+}
+
+void AudioManager::stop_sfx() {
+    sfx_->stopAll();
 }
 
 void AudioManager::set_current_music(MusicId music_id) {
-    if (current_music_.getStatus() == sf::Music::Status::Playing) {
-        current_music_.stop();
-    }
-    Logger::info("Setting current music to ID: {}", static_cast<int>(music_id));
-    try {
-        if (!current_music_.openFromFile(get_music_path(music_id))) {
-            throw sf::Exception("Failed to open music file");
-        }
-        current_music_.setVolume(music_volume_);
-        current_music_.setLooping(true);
-        current_music_.play();
-    } catch (const sf::Exception&) {
-        Logger::error("Failed to load music: {}", get_music_path(music_id));
-    }
+    music_->play(music_id);
+}
+
+void AudioManager::prefetch_music(MusicId music_id) {
+    music_->prefetch(music_id);
+}
+
+void AudioManager::set_music_crossfade(float seconds) {
+    music_->setCrossfadeDuration(seconds);
+}
+
+void AudioManager::update(float dt) {
+    sfx_->flush();
+    music_->update(dt);
 }
 
 void AudioManager::set_sfx_volume(float volume) {
     sfx_volume_ = std::min(std::max(volume, 0.0f), 100.0f);
-    for (auto& sound : sounds_) {
-        if (sound) {
-            sound->setVolume(sfx_volume_);
-        }
-    }
+    sfx_->setVolume(sfx_volume_);
 }
 
 void AudioManager::set_music_volume(float volume) {
     music_volume_ = std::min(std::max(volume, 0.0f), 100.0f);
-    current_music_.setVolume(music_volume_);
+    music_->setVolume(music_volume_);
 }
 
 void AudioManager::pause_music() {
-    if (current_music_.getStatus() == sf::Music::Status::Playing) {
-        current_music_.pause();
-    }
+    music_->pause();
 }
 
 void AudioManager::resume_music() {
-    if (current_music_.getStatus() == sf::Music::Status::Paused) {
-        current_music_.play();
-    }
+    music_->resume();
 }
 
 void AudioManager::stop_music() {
-    current_music_.stop();
+    music_->stop();
 }
 
 bool AudioManager::is_music_playing() const {
-    return current_music_.getStatus() == sf::Music::Status::Playing;
-}
\ No newline at end of file
+    return music_->isPlaying();
+}
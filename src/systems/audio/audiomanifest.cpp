@@ -0,0 +1,97 @@
+#include "joanna/systems/audiomanifest.h"
+
+#include "joanna/utils/logger.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace {
+
+SoundLoad parseLoad(const std::string& load) {
+    if (load == "lazy") {
+        return SoundLoad::Lazy;
+    }
+    if (load == "stream") {
+        return SoundLoad::Stream;
+    }
+    if (load != "preload") {
+        Logger::warning("Unknown sound load mode: {}", load);
+    }
+    return SoundLoad::Preload;
+}
+
+} // namespace
+
+AudioManifest AudioManifest::compile(const nlohmann::json& data) {
+    AudioManifest manifest;
+
+    std::unordered_map<std::string, std::uint8_t> groupIds;
+    for (const auto& raw : data.value("groups", nlohmann::json::array())) {
+        SoundGroup group;
+        group.name = raw.at("name").get<std::string>();
+        group.volume = std::clamp(raw.value("volume", 1.f), 0.f, 1.f);
+        groupIds.emplace(
+            group.name, static_cast<std::uint8_t>(manifest.groups.size())
+        );
+        manifest.groups.push_back(std::move(group));
+    }
+    if (manifest.groups.empty()) {
+        manifest.groups.push_back({ "default", 1.f });
+    }
+
+    for (const auto& raw : data.value("sounds", nlohmann::json::array())) {
+        SoundDefinition sound;
+        sound.name = raw.at("name").get<std::string>();
+        sound.path = raw.at("path").get<std::string>();
+        sound.load = parseLoad(raw.value("load", std::string("preload")));
+        sound.volume = std::clamp(raw.value("volume", 1.f), 0.f, 1.f);
+        sound.maxInstances = static_cast<std::uint8_t>(
+            std::clamp(raw.value("maxInstances", 2), 1, 255)
+        );
+        sound.priority = raw.value("priority", std::uint8_t{ 0 });
+
+        const std::string group = raw.value("group", std::string());
+        if (const auto it = groupIds.find(group); it != groupIds.end()) {
+            sound.group = it->second;
+        } else if (!group.empty()) {
+            Logger::warning("Unknown sound group {} of {}", group, sound.name);
+        }
+
+        if (manifest.ids.contains(sound.name)) {
+            Logger::warning("Duplicate sound {} ignored", sound.name);
+            continue;
+        }
+        const auto id = static_cast<SoundId>(manifest.sounds.size());
+        manifest.ids.emplace(sound.name, id);
+        manifest.sounds.push_back(std::move(sound));
+    }
+
+    Logger::info(
+        "Compiled {} sounds in {} groups", manifest.sounds.size(),
+        manifest.groups.size()
+    );
+    return manifest;
+}
+
+const AudioManifest& AudioManifest::getInstance() {
+    static const AudioManifest instance = [] {
+        std::ifstream file(DEFAULT_PATH);
+        try {
+            return compile(nlohmann::json::parse(file));
+        } catch (const std::exception& e) {
+            Logger::error("Failed to load {}: {}", DEFAULT_PATH, e.what());
+            return AudioManifest();
+        }
+    }();
+    return instance;
+}
+
+SoundId AudioManifest::find(std::string_view name) const {
+    const auto it = ids.find(name);
+    return it != ids.end() ? it->second : NO_SOUND;
+}
+
+float AudioManifest::getVolume(const SoundId id) const {
+    const SoundDefinition& sound = sounds.at(id);
+    return sound.volume * groups.at(sound.group).volume;
+}
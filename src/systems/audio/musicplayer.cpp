@@ -0,0 +1,323 @@
+#include "joanna/systems/musicplayer.h"
+
+#include "joanna/utils/logger.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+MusicPlayer::MusicPlayer(const AudioManifest& manifest) : manifest(manifest) {
+    for (std::size_t i = 0; i < MUSIC_COUNT; ++i) {
+        const std::string_view name = getName(static_cast<MusicId>(i));
+        sounds.at(i) = manifest.find(name);
+        if (sounds.at(i) == NO_SOUND) {
+            Logger::error("Music missing from the manifest: {}", name);
+        }
+    }
+}
+
+MusicPlayer::~MusicPlayer() {
+    if (loader.joinable()) {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        loader.join();
+    }
+}
+
+std::string_view MusicPlayer::getName(const MusicId id) {
+    switch (id) {
+        case MusicId::Overworld:
+            return "overworld";
+        case MusicId::Underworld:
+            return "underworld";
+        case MusicId::Beach:
+            return "beach";
+        case MusicId::Combat:
+            return "combat";
+        case MusicId::GameOver:
+            return "game_over";
+        default:
+            throw std::invalid_argument("Invalid MusicId");
+    }
+}
+
+void MusicPlayer::play(const MusicId id) {
+    Logger::info("Setting current music to ID: {}", static_cast<int>(id));
+    if (current && current->id == id) {
+        requested.reset();
+        return;
+    }
+
+    // switching back while the track still fades out resumes it in place
+    const auto fading = std::find_if(
+        fadingOut.begin(), fadingOut.end(),
+        [id](const Track& track) { return track.id == id; }
+    );
+    if (fading != fadingOut.end()) {
+        Track track = std::move(*fading);
+        fadingOut.erase(fading);
+        if (current) {
+            fadingOut.push_back(std::move(*current));
+        }
+        current = std::move(track);
+        requested.reset();
+        return;
+    }
+
+    requested = id;
+    startRequested();
+    if (requested) {
+        request(id);
+    }
+}
+
+void MusicPlayer::prefetch(const MusicId id) {
+    if (!isKnown(id)) {
+        request(id);
+    }
+}
+
+bool MusicPlayer::isKnown(const MusicId id) const {
+    const auto matches = [id](const Track& track) { return track.id == id; };
+    return (current && current->id == id) ||
+           std::any_of(fadingOut.begin(), fadingOut.end(), matches) ||
+           std::any_of(prepared.begin(), prepared.end(), matches);
+}
+
+void MusicPlayer::request(const MusicId id) {
+    {
+        const std::lock_guard lock(mutex);
+        if (std::find(loading.begin(), loading.end(), id) != loading.end()) {
+            return;
+        }
+        loading.push_back(id);
+        toLoad.push_back(id);
+    }
+    startLoader();
+    wake.notify_one();
+}
+
+void MusicPlayer::startLoader() {
+    if (!loader.joinable()) {
+        loader = std::thread([this] { loaderLoop(); });
+    }
+}
+
+void MusicPlayer::loaderLoop() {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] {
+            return stopping || !toLoad.empty() || !toClose.empty() ||
+                   !toRewind.empty();
+        });
+        if (stopping) {
+            return;
+        }
+
+        // closing a stream closes its file, keep that off the game thread
+        std::vector<std::unique_ptr<sf::Music>> closing;
+        closing.swap(toClose);
+        if (!closing.empty()) {
+            lock.unlock();
+            closing.clear();
+            lock.lock();
+            continue;
+        }
+
+        std::vector<Track> rewinding;
+        rewinding.swap(toRewind);
+        if (!rewinding.empty()) {
+            lock.unlock();
+            for (Track& track : rewinding) {
+                track.music->stop(); // seeks back to the start of the file
+            }
+            lock.lock();
+            for (Track& track : rewinding) {
+                loading.erase(
+                    std::find(loading.begin(), loading.end(), track.id)
+                );
+                loaded.push_back(std::move(track));
+            }
+            continue;
+        }
+
+        const MusicId id = toLoad.front();
+        toLoad.pop_front();
+        lock.unlock();
+
+        // the manifest is never modified, reading it here is safe
+        const SoundId sound = sounds.at(static_cast<std::size_t>(id));
+        auto music = std::make_unique<sf::Music>();
+        if (sound != NO_SOUND &&
+            music->openFromFile(manifest.get(sound).path)) {
+            music->setLooping(true);
+        } else {
+            Logger::error("Failed to load music: {}", getName(id));
+            music.reset();
+        }
+
+        lock.lock();
+        loading.erase(std::find(loading.begin(), loading.end(), id));
+        if (music) {
+            loaded.push_back({ id, std::move(music) });
+        }
+    }
+}
+
+void MusicPlayer::collectLoaded() {
+    std::vector<Track> ready;
+    {
+        const std::lock_guard lock(mutex);
+        ready.swap(loaded);
+    }
+    for (Track& track : ready) {
+        if (isKnown(track.id)) {
+            continue; // loaded twice, the extra stream is dropped below
+        }
+        park(std::move(track));
+    }
+    if (!ready.empty()) {
+        const std::lock_guard lock(mutex);
+        for (Track& track : ready) {
+            if (track.music) {
+                toClose.push_back(std::move(track.music));
+            }
+        }
+        wake.notify_one();
+    }
+}
+
+void MusicPlayer::startRequested() {
+    if (!requested) {
+        return;
+    }
+    const auto it = std::find_if(
+        prepared.begin(), prepared.end(),
+        [this](const Track& track) { return track.id == *requested; }
+    );
+    if (it == prepared.end()) {
+        return;
+    }
+
+    Track track = std::move(*it);
+    prepared.erase(it);
+    track.gain = 0.f;
+    applyVolume(track);
+    if (!paused) {
+        track.music->play();
+    }
+    if (current) {
+        fadingOut.push_back(std::move(*current));
+    }
+    current = std::move(track);
+    requested.reset();
+}
+
+void MusicPlayer::park(Track track) {
+    track.gain = 0.f;
+    prepared.push_back(std::move(track));
+    if (prepared.size() > MAX_PREPARED) {
+        const std::lock_guard lock(mutex);
+        toClose.push_back(std::move(prepared.front().music));
+        prepared.erase(prepared.begin());
+        wake.notify_one();
+    }
+}
+
+void MusicPlayer::retire(Track track) {
+    track.music->pause(); // silent at once, no seek
+    {
+        const std::lock_guard lock(mutex);
+        // counts as loading, so play() waits for it instead of reopening
+        loading.push_back(track.id);
+        toRewind.push_back(std::move(track));
+    }
+    startLoader();
+    wake.notify_one();
+}
+
+void MusicPlayer::update(const float dt) {
+    collectLoaded();
+    startRequested();
+    if (paused) {
+        return;
+    }
+
+    const float step = crossfadeDuration > 0.f ? dt / crossfadeDuration : 1.f;
+    if (current && current->gain < 1.f) {
+        current->gain = std::min(1.f, current->gain + step);
+        applyVolume(*current);
+    }
+    for (auto it = fadingOut.begin(); it != fadingOut.end();) {
+        it->gain -= step;
+        if (it->gain <= 0.f) {
+            Track track = std::move(*it);
+            it = fadingOut.erase(it);
+            retire(std::move(track));
+        } else {
+            applyVolume(*it);
+            ++it;
+        }
+    }
+}
+
+void MusicPlayer::applyVolume(Track& track) const {
+    const SoundId sound = sounds.at(static_cast<std::size_t>(track.id));
+    track.music->setVolume(volume * manifest.getVolume(sound) * track.gain);
+}
+
+void MusicPlayer::setVolume(const float newVolume) {
+    volume = std::clamp(newVolume, 0.f, 100.f);
+    if (current) {
+        applyVolume(*current);
+    }
+    for (Track& track : fadingOut) {
+        applyVolume(track);
+    }
+}
+
+void MusicPlayer::setCrossfadeDuration(const float seconds) {
+    crossfadeDuration = std::max(0.f, seconds);
+}
+
+void MusicPlayer::pause() {
+    paused = true;
+    if (current) {
+        current->music->pause();
+    }
+    for (Track& track : fadingOut) {
+        track.music->pause();
+    }
+}
+
+void MusicPlayer::resume() {
+    if (!paused) {
+        return;
+    }
+    paused = false;
+    if (current) {
+        current->music->play();
+    }
+    for (Track& track : fadingOut) {
+        track.music->play();
+    }
+}
+
+void MusicPlayer::stop() {
+    requested.reset();
+    if (current) {
+        retire(std::move(*current));
+        current.reset();
+    }
+    for (Track& track : fadingOut) {
+        retire(std::move(track));
+    }
+    fadingOut.clear();
+}
+
+bool MusicPlayer::isPlaying() const {
+    return current &&
+           current->music->getStatus() == sf::Music::Status::Playing;
+}
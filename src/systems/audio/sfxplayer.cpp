@@ -0,0 +1,249 @@
+#include "joanna/systems/sfxplayer.h"
+
+#include "joanna/utils/logger.h"
+#include "joanna/utils/resourcemanager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+SfxPlayer::SfxPlayer(const AudioManifest& manifest)
+    : manifest(manifest), buffers(manifest.size(), nullptr),
+      failed(manifest.size(), false), requested(manifest.size(), false),
+      lazyBuffers(manifest.size()) {
+    for (std::size_t i = 0; i < SFX_COUNT; ++i) {
+        const std::string_view name = getName(static_cast<SfxId>(i));
+        builtins.at(i) = manifest.find(name);
+        if (builtins.at(i) == NO_SOUND) {
+            Logger::error("Sound effect missing from the manifest: {}", name);
+        }
+    }
+
+    for (SoundId id = 0; id < manifest.size(); ++id) {
+        if (manifest.get(id).load == SoundLoad::Preload) {
+            getBuffer(id);
+        }
+    }
+}
+
+SfxPlayer::~SfxPlayer() {
+    if (loader.joinable()) {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        loader.join();
+    }
+}
+
+std::string_view SfxPlayer::getName(const SfxId id) {
+    switch (id) {
+        case SfxId::Hit:
+            return "hit";
+        case SfxId::Click:
+            return "click";
+        case SfxId::Footstep:
+            return "footstep";
+        case SfxId::Dead:
+            return "dead";
+        case SfxId::Surprise:
+            return "surprise";
+        case SfxId::Collect:
+            return "collect";
+        case SfxId::Damage:
+            return "damage";
+        case SfxId::Break:
+            return "break";
+        case SfxId::Chest:
+            return "chest";
+        default:
+            throw std::invalid_argument("Invalid SfxId");
+    }
+}
+
+const sf::SoundBuffer* SfxPlayer::getBuffer(const SoundId id) {
+    if (buffers.at(id) != nullptr || failed.at(id)) {
+        return buffers.at(id);
+    }
+
+    const SoundDefinition& sound = manifest.get(id);
+    if (sound.load == SoundLoad::Stream) {
+        Logger::error("Streamed sound {} cannot play as an effect", sound.name);
+        failed.at(id) = true;
+        return nullptr;
+    }
+    if (sound.load == SoundLoad::Lazy) {
+        request(id);
+        return nullptr; // ready in a later flush()
+    }
+    try {
+        buffers.at(id) =
+            &ResourceManager<sf::SoundBuffer>::getInstance()->get(sound.path);
+    } catch (const std::exception& e) {
+        Logger::error("Failed to load sound effect: {}", e.what());
+        failed.at(id) = true;
+    }
+    return buffers.at(id);
+}
+
+void SfxPlayer::request(const SoundId id) {
+    if (requested.at(id)) {
+        return;
+    }
+    requested.at(id) = true;
+    {
+        const std::lock_guard lock(mutex);
+        toDecode.push_back(id);
+    }
+    if (!loader.joinable()) {
+        loader = std::thread([this] { loaderLoop(); });
+    }
+    wake.notify_one();
+}
+
+void SfxPlayer::loaderLoop() {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || !toDecode.empty(); });
+        if (stopping) {
+            return;
+        }
+        const SoundId id = toDecode.front();
+        toDecode.pop_front();
+        lock.unlock();
+
+        // the manifest is never modified, reading it here is safe
+        const std::string& path = manifest.get(id).path;
+        auto buffer = std::make_unique<sf::SoundBuffer>();
+        if (!buffer->loadFromFile(path)) {
+            Logger::error("Failed to load sound effect: {}", path);
+            buffer.reset();
+        }
+
+        lock.lock();
+        decoded.emplace_back(id, std::move(buffer));
+    }
+}
+
+void SfxPlayer::collectDecoded() {
+    std::vector<Decoded> ready;
+    {
+        const std::lock_guard lock(mutex);
+        ready.swap(decoded);
+    }
+    for (auto& [id, buffer] : ready) {
+        if (buffer) {
+            lazyBuffers.at(id) = std::move(buffer);
+            buffers.at(id) = lazyBuffers.at(id).get();
+        } else {
+            failed.at(id) = true;
+        }
+    }
+}
+
+float SfxPlayer::attenuation(const float distance) {
+    if (distance <= MIN_DISTANCE) {
+        return 1.f;
+    }
+    if (distance >= MAX_DISTANCE) {
+        return 0.f;
+    }
+    return 1.f - ((distance - MIN_DISTANCE) / (MAX_DISTANCE - MIN_DISTANCE));
+}
+
+void SfxPlayer::trigger(const SfxId id) {
+    trigger(builtins.at(static_cast<std::size_t>(id)));
+}
+
+void SfxPlayer::trigger(const SfxId id, const sf::Vector2f position) {
+    trigger(builtins.at(static_cast<std::size_t>(id)), position);
+}
+
+void SfxPlayer::trigger(const SoundId id) {
+    addTrigger(id, 1.f);
+}
+
+void SfxPlayer::trigger(const SoundId id, const sf::Vector2f position) {
+    const sf::Vector2f delta = position - listener;
+    addTrigger(id, attenuation(std::hypot(delta.x, delta.y)));
+}
+
+void SfxPlayer::addTrigger(const SoundId id, const float gain) {
+    if (id >= manifest.size() || gain <= 0.f) {
+        return;
+    }
+    triggers.add(id, gain);
+}
+
+bool SfxPlayer::isPlaying(const std::size_t voice) const {
+    return sounds.at(voice) &&
+           sounds.at(voice)->getStatus() == sf::Sound::Status::Playing;
+}
+
+void SfxPlayer::flush() {
+    for (std::size_t voice = 0; voice < VOICE_COUNT; ++voice) {
+        if (pool.isBusy(voice) && !isPlaying(voice)) {
+            pool.release(voice);
+        }
+    }
+
+    collectDecoded();
+    for (const TriggerBatch::Trigger& trigger : waiting) {
+        triggers.add(trigger.id, trigger.gain);
+    }
+    waiting.clear();
+
+    for (const TriggerBatch::Trigger& trigger : triggers) {
+        const sf::SoundBuffer* buffer = getBuffer(trigger.id);
+        if (buffer == nullptr) {
+            if (!failed.at(trigger.id)) {
+                waiting.add(trigger.id, trigger.gain); // still decoding
+            }
+            continue;
+        }
+        const SoundDefinition& settings = manifest.get(trigger.id);
+        const std::size_t voice = pool.allocate(
+            trigger.id, settings.maxInstances, settings.priority
+        );
+        if (voice == VoicePool::NO_VOICE) {
+            continue;
+        }
+
+        std::optional<sf::Sound>& sound = sounds.at(voice);
+        if (sound) {
+            sound->stop();
+            sound->setBuffer(*buffer);
+        } else {
+            sound.emplace(*buffer);
+        }
+        sound->setVolume(
+            volume * manifest.getVolume(trigger.id) * trigger.gain
+        );
+        sound->play();
+    }
+    triggers.clear();
+}
+
+void SfxPlayer::setVolume(const float newVolume) {
+    volume = std::clamp(newVolume, 0.f, 100.f);
+}
+
+void SfxPlayer::stopAll() {
+    triggers.clear();
+    waiting.clear();
+    for (std::optional<sf::Sound>& sound : sounds) {
+        if (sound) {
+            sound->stop();
+        }
+    }
+    pool.releaseAll();
+}
+
+std::size_t SfxPlayer::getActiveVoices() const {
+    std::size_t active = 0;
+    for (std::size_t voice = 0; voice < VOICE_COUNT; ++voice) {
+        active += isPlaying(voice) ? 1 : 0;
+    }
+    return active;
+}
@@ -0,0 +1,79 @@
+#include "joanna/systems/voicepool.h"
+
+#include <algorithm>
+
+bool TriggerBatch::add(const SoundId id, const float gain) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (triggers.at(i).id == id) {
+            triggers.at(i).gain = std::max(triggers.at(i).gain, gain);
+            return true;
+        }
+    }
+    if (count == CAPACITY) {
+        return false;
+    }
+    triggers.at(count++) = { id, gain };
+    return true;
+}
+
+VoicePool::VoicePool(const std::size_t voiceCount) : voices(voiceCount) {}
+
+std::size_t VoicePool::allocate(
+    const SoundId id, const std::uint8_t maxInstances,
+    const std::uint8_t priority
+) {
+    std::size_t instances = 0;
+    std::size_t oldestInstance = NO_VOICE;
+    std::size_t freeVoice = NO_VOICE;
+    std::size_t victim = NO_VOICE;
+    for (std::size_t i = 0; i < voices.size(); ++i) {
+        const Voice& voice = voices[i];
+        if (!voice.busy) {
+            freeVoice = freeVoice != NO_VOICE ? freeVoice : i;
+            continue;
+        }
+        if (voice.id == id) {
+            ++instances;
+            if (oldestInstance == NO_VOICE ||
+                voice.startedAt < voices[oldestInstance].startedAt) {
+                oldestInstance = i;
+            }
+        }
+        if (victim == NO_VOICE || voice.priority < voices[victim].priority ||
+            (voice.priority == voices[victim].priority &&
+             voice.startedAt < voices[victim].startedAt)) {
+            victim = i;
+        }
+    }
+
+    std::size_t chosen = NO_VOICE;
+    if (instances >= maxInstances) {
+        chosen = oldestInstance; // restart the oldest copy
+    } else if (freeVoice != NO_VOICE) {
+        chosen = freeVoice;
+    } else if (victim != NO_VOICE && voices[victim].priority <= priority) {
+        chosen = victim;
+    }
+    if (chosen != NO_VOICE) {
+        voices[chosen] = { id, priority, ++startCounter, true };
+    }
+    return chosen;
+}
+
+void VoicePool::release(const std::size_t voice) {
+    voices.at(voice).busy = false;
+}
+
+void VoicePool::releaseAll() {
+    for (Voice& voice : voices) {
+        voice.busy = false;
+    }
+}
+
+std::size_t VoicePool::getBusyCount() const {
+    return static_cast<std::size_t>(
+        std::count_if(voices.begin(), voices.end(), [](const Voice& voice) {
+            return voice.busy;
+        })
+    );
+}
@@ -0,0 +1,111 @@
+#include "joanna/systems/dialoguetable.h"
+#include "joanna/utils/logger.h"
+
+#include <algorithm>
+
+namespace {
+// item ids are tile gids stored as text in dialog.json
+ItemId internItem(const nlohmann::json& gid, std::string_view name = {}) {
+    return ItemRegistry::getInstance().intern(
+        static_cast<std::uint32_t>(std::stoul(gid.get<std::string>())), name
+    );
+}
+
+DialogueRequirement compileRequirement(const nlohmann::json& req) {
+    DialogueRequirement requirement;
+    if (req.is_null()) {
+        return requirement;
+    }
+
+    const std::string type = req.value("type", "");
+    if (type == "ITEM_REMOVE") {
+        requirement.type = RequirementType::ItemRemove;
+    } else if (type.find("ITEM") != std::string::npos) {
+        requirement.type = RequirementType::Item;
+    } else {
+        Logger::warning("Unknown dialogue requirement type: {}", type);
+        return requirement;
+    }
+
+    requirement.item = internItem(req.at("id"));
+    requirement.amount = req.value("amount", 1u);
+    return requirement;
+}
+} // namespace
+
+std::uint32_t DialogueTable::intern(const std::string& name) {
+    auto [it, inserted] =
+        nameIds.try_emplace(name, static_cast<std::uint32_t>(names.size()));
+    if (inserted) {
+        names.push_back(name);
+    }
+    return it->second;
+}
+
+DialogueTable DialogueTable::compile(const nlohmann::json& data) {
+    DialogueTable table;
+
+    for (const auto& [dialogId, rawList] : data.items()) {
+        Range range{ table.entries.size(), rawList.size() };
+
+        for (const auto& raw : rawList) {
+            DialogueEntry entry;
+            entry.priority = raw.value("priority", 0);
+            if (raw.contains("id")) {
+                entry.id = table.intern(raw["id"].get<std::string>());
+            }
+            if (raw.contains("req")) {
+                entry.requirement = compileRequirement(raw["req"]);
+            }
+            entry.text = raw.at("text").get<std::vector<std::string>>();
+
+            if (raw.contains("reward") && !raw["reward"].is_null()) {
+                const auto& reward = raw["reward"];
+                entry.reward = Item(internItem(
+                    reward.at("id"), reward.value("name", std::string())
+                ));
+            }
+
+            if (raw.contains("move") && raw["move"].is_array()) {
+                entry.hasMove = true;
+                for (const auto& step : raw["move"]) {
+                    entry.move.emplace_back(
+                        step.value("x", 0.f), step.value("y", 0.f)
+                    );
+                }
+            }
+            table.entries.push_back(std::move(entry));
+        }
+
+        std::stable_sort(
+            table.entries.begin() + static_cast<std::ptrdiff_t>(range.first),
+            table.entries.end(),
+            [](const DialogueEntry& a, const DialogueEntry& b) {
+                return a.priority > b.priority;
+            }
+        );
+        table.scripts.emplace(dialogId, range);
+    }
+
+    Logger::info(
+        "Compiled {} dialogue entries for {} NPCs", table.entries.size(),
+        table.scripts.size()
+    );
+    return table;
+}
+
+std::span<const DialogueEntry>
+DialogueTable::getEntries(std::string_view dialogId) const {
+    auto it = scripts.find(std::string(dialogId));
+    if (it == scripts.end()) {
+        return {};
+    }
+    return std::span<const DialogueEntry>(entries).subspan(
+        it->second.first, it->second.count
+    );
+}
+
+std::uint32_t DialogueTable::findId(std::string_view name) const {
+    auto it = nameIds.find(std::string(name));
+    return it != nameIds.end() ? it->second : DialogueEntry::NO_ID;
+}
@@ -13,7 +13,6 @@
 #include <SFML/Graphics/View.hpp>
 #include <algorithm>
 #include <joanna/entities/npc.h>
-#include <limits>
 
 Controller::Controller(
     WindowManager& windowManager, AudioManager& audioManager, Game& game
@@ -31,6 +30,32 @@ Controller::Controller(
 
 // clang-format on
 
+InputSnapshot Controller::sampleKeyboard() {
+    using Key = sf::Keyboard::Key;
+    const auto down = [](Key key) { return sf::Keyboard::isKeyPressed(key); };
+
+    InputSnapshot snapshot;
+    snapshot.set(InputAction::Left, down(Key::A));
+    snapshot.set(InputAction::Right, down(Key::D));
+    snapshot.set(InputAction::Up, down(Key::W));
+    snapshot.set(InputAction::Down, down(Key::S));
+    snapshot.set(InputAction::Sprint, down(Key::LShift));
+    snapshot.set(InputAction::MapToggle, down(Key::M));
+    snapshot.set(InputAction::Apply, down(Key::E));
+    snapshot.set(InputAction::Pickup, down(Key::Space));
+    snapshot.set(InputAction::Talk, down(Key::T));
+    snapshot.set(InputAction::Menu, down(Key::P) || down(Key::Escape));
+    snapshot.set(InputAction::Slot1, down(Key::Num1));
+    snapshot.set(InputAction::Slot2, down(Key::Num2));
+    snapshot.set(InputAction::Slot3, down(Key::Num3));
+    snapshot.set(InputAction::Slot4, down(Key::Num4));
+    snapshot.set(InputAction::Slot5, down(Key::Num5));
+    snapshot.set(InputAction::Slot6, down(Key::Num6));
+    snapshot.set(InputAction::Slot7, down(Key::Num7));
+    snapshot.set(InputAction::Slot8, down(Key::Num8));
+    return snapshot;
+}
+
 bool Controller::getInput(
     float dt, sf::RenderWindow& window,
     const std::vector<sf::FloatRect>& collisions,
@@ -38,7 +63,7 @@ bool Controller::getInput(
     const std::shared_ptr<DialogueBox>& sharedDialogueBox,
     TileManager& tileManager, RenderEngine& renderEngine
 ) {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::M)) {
+    if (input.isDown(InputAction::MapToggle)) {
         if (!mPressed) {
             showMapOverview = !showMapOverview;
             sf::View& mapView = windowManager.getMapOverviewView();
@@ -55,25 +80,25 @@ bool Controller::getInput(
     sf::Vector2f dir{ 0.f, 0.f };
 
     if (player.getState() != State::Mining) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) {
+        if (input.isDown(InputAction::Left)) {
             dir.x -= 1.f * factor * dt;
             facingLeft = true;
             state = State::Walking;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) {
+        if (input.isDown(InputAction::Right)) {
             dir.x += 1.f * factor * dt;
             facingLeft = false;
             state = State::Walking;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) {
+        if (input.isDown(InputAction::Up)) {
             dir.y -= 1.f * factor * dt;
             state = State::Walking;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S)) {
+        if (input.isDown(InputAction::Down)) {
             dir.y += 1.f * factor * dt;
             state = State::Walking;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LShift)) {
+        if (input.isDown(InputAction::Sprint)) {
             dir *= 1.5f;
             state = State::Running;
         }
@@ -87,35 +112,35 @@ bool Controller::getInput(
     }
 
     // Inventory toggle
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num1)) {
+    if (input.isDown(InputAction::Slot1)) {
         player.getInventory().selectSlot(0);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num2)) {
+    if (input.isDown(InputAction::Slot2)) {
         player.getInventory().selectSlot(1);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num3)) {
+    if (input.isDown(InputAction::Slot3)) {
         player.getInventory().selectSlot(2);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num4)) {
+    if (input.isDown(InputAction::Slot4)) {
         player.getInventory().selectSlot(3);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num5)) {
+    if (input.isDown(InputAction::Slot5)) {
         player.getInventory().selectSlot(4);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num6)) {
+    if (input.isDown(InputAction::Slot6)) {
         player.getInventory().selectSlot(5);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num7)) {
+    if (input.isDown(InputAction::Slot7)) {
         player.getInventory().selectSlot(6);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num8)) {
+    if (input.isDown(InputAction::Slot8)) {
         player.getInventory().selectSlot(7);
     }
 
-    bool eDown = (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::E));
+    bool eDown = input.isDown(InputAction::Apply);
     if (eDown && !keyPressed) {
         auto id = player.getInventory().getSelectedItemId();
-        if (id != "") {
+        if (id != NO_ITEM) {
             auto hasApplied = player.applyItem(id);
             if (hasApplied) {
                 audioManager.play_sfx(SfxId::Surprise);
@@ -123,59 +148,31 @@ bool Controller::getInput(
         }
     }
 
-    bool spaceDown = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space);
-    if (spaceDown && !keyPressed) {
-        for (const auto& item : tileManager.getRenderObjects()) {
-            auto playerPos = player.getPosition();
-            auto itemPos = item.position;
-            auto item_gid = item.gid;
-            float dx = playerPos.x - static_cast<float>(itemPos.x);
-            float dy = playerPos.y - static_cast<float>(itemPos.y);
-            if (dx * dx + dy * dy <= 16.f * 16.f) {
-                if (tileManager.removeObjectById(static_cast<int>(item.id))) {
-                    auto map = player.getInventory().mapGidToName();
-                    player.gainExp(5);
-                    audioManager.play_sfx(SfxId::Collect);
-                    player.addItemToInventory(Item(
-                        std::to_string(item_gid),
-                        map[static_cast<int>(item_gid)]
-                    ));
-                    break;
-                }
-            }
+    const InteractionTargets& targets = interactions.getTargets();
+
+    bool spaceDown = input.isDown(InputAction::Pickup);
+    if (spaceDown && !keyPressed && !targets.pickups.empty()) {
+        const uint32_t gid =
+            tileManager.getObjectById(targets.pickups.front())->gid;
+        if (tileManager.removeObjectById(
+                static_cast<int>(targets.pickups.front())
+            )) {
+            player.gainExp(5);
+            audioManager.play_sfx(SfxId::Collect);
+            player.addItemToInventory(
+                Item(ItemRegistry::getInstance().intern(gid))
+            );
         }
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::T) &&
+    if (input.isDown(InputAction::Talk) &&
         !sharedDialogueBox->isActive()) {
-        Interactable* closestInteractable = nullptr;
-        float minDistanceSq = std::numeric_limits<float>::max();
-        sf::Vector2f playerPos = player.getPosition();
-
-        for (auto& entity : entities) {
-            if (auto* interactable =
-                    dynamic_cast<Interactable*>(entity.get())) {
-                if (interactable->canPlayerInteract(playerPos)) {
-                    sf::Vector2f entityPos = entity->getPosition();
-                    float dx = playerPos.x - entityPos.x;
-                    float dy = playerPos.y - entityPos.y;
-                    float distSq = dx * dx + dy * dy;
-
-                    if (distSq < minDistanceSq) {
-                        minDistanceSq = distSq;
-                        closestInteractable = interactable;
-                    }
-                }
-            }
-        }
-
-        if (closestInteractable) {
+        if (Interactable* closestInteractable = targets.closest()) {
             closestInteractable->interact(player);
         }
     }
 
-    bool pDown = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::P) ||
-                 sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape);
-    if (pDown && !keyPressed) {
+    bool pDown = input.isDown(InputAction::Menu);
+    if (pDown && !keyPressed && menuEnabled) {
         Menu menu(
             windowManager, *this, tileManager, audioManager, entities, game
         );
@@ -186,21 +183,13 @@ bool Controller::getInput(
         return true;
     }
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space)) {
+    if (spaceDown) {
         if (sharedDialogueBox->isActive() && !sharedDialogueBox->isTyping()) {
             sharedDialogueBox->nextLine();
         }
     }
 
-    bool anyInteractionPoissible =
-        std::any_of(entities.begin(), entities.end(), [this](const auto& obj) {
-            if (auto* npc = dynamic_cast<NPC*>(obj.get())) {
-                return npc->canPlayerInteract(player.getPosition());
-            }
-            return false;
-        });
-
-    if (sharedDialogueBox->isActive() && !anyInteractionPoissible &&
+    if (sharedDialogueBox->isActive() && !targets.npcInRange &&
         sharedDialogueBox->getOwner() != nullptr) {
         sharedDialogueBox->hide();
     }
@@ -233,6 +222,10 @@ bool Controller::updateStep(
         if (auto* npc = dynamic_cast<NPC*>(entity.get())) {
             npc->update(dt, player);
         }
+        // cheap unless the entity crossed an index cell
+        if (auto* interactable = dynamic_cast<Interactable*>(entity.get())) {
+            interactions.track(*interactable);
+        }
         if (auto* stone = dynamic_cast<Stone*>(entity.get())) {
             stone->update(dt, player);
         }
@@ -243,13 +236,15 @@ bool Controller::updateStep(
         if (auto* stone = dynamic_cast<Stone*>(e.get())) {
             auto b = stone->shouldBeRemoved();
             if (b) {
-                player.addInteraction(stone->getStoneId());
-                audioManager.play_sfx(SfxId::Break);
+                player.setFlag(stone->getFlag());
+                audioManager.play_sfx(SfxId::Break, stone->getPosition());
+                interactions.forget(*stone);
             }
             return b;
         }
         return false;
     });
+    interactions.refresh(player.getPosition(), tileManager);
     return getInput(
         dt, window, collisions, entities, sharedDialogueBox, tileManager,
         renderEngine
@@ -0,0 +1,169 @@
+#include "joanna/systems/inputrecorder.h"
+
+#include "joanna/utils/logger.h"
+
+#include <array>
+#include <cstring>
+#include <iterator>
+
+namespace {
+constexpr std::array<char, 4> MAGIC = { 'J', 'R', 'E', 'C' };
+constexpr std::size_t HEADER_SIZE = 4 + 2 + 2 + 8 + 4;
+constexpr std::size_t TICK_SIZE = 4 + 4;
+
+template <typename T> void putLE(std::vector<char>& out, T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+template <typename T> T getLE(const char* in) {
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<unsigned char>(in[i])) << (8 * i);
+    }
+    return value;
+}
+} // namespace
+
+InputRecorder::~InputRecorder() {
+    stop();
+}
+
+void InputRecorder::startRecording(
+    const std::filesystem::path& path, std::uint64_t seed
+) {
+    stop();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    std::vector<char> header;
+    header.insert(header.end(), MAGIC.begin(), MAGIC.end());
+    putLE<std::uint16_t>(header, VERSION);
+    putLE<std::uint16_t>(header, 0);
+    putLE<std::uint64_t>(header, seed);
+    putLE<std::uint32_t>(header, 0); // tick count, updated on every flush
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.flush();
+    if (!file.good()) {
+        Logger::error("Could not open input recording: {}", path.string());
+        file.close();
+        return;
+    }
+
+    this->mode = Mode::Record;
+    this->filePath = path;
+    this->seed = seed;
+    this->ticks.clear();
+    this->flushedTicks = 0;
+    this->cursor = 0;
+    Logger::info("Recording input to {} (seed {})", path.string(), seed);
+}
+
+bool InputRecorder::startReplay(const std::filesystem::path& path) {
+    stop();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        Logger::error("Could not open input recording: {}", path.string());
+        return false;
+    }
+    const std::vector<char> data(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()
+    );
+
+    if (data.size() < HEADER_SIZE ||
+        std::memcmp(data.data(), MAGIC.data(), MAGIC.size()) != 0) {
+        Logger::error("Invalid input recording: {}", path.string());
+        return false;
+    }
+    const auto version = getLE<std::uint16_t>(data.data() + 4);
+    if (version != VERSION) {
+        Logger::error("Unsupported input recording version: {}", version);
+        return false;
+    }
+    const auto count = getLE<std::uint32_t>(data.data() + 16);
+    if (data.size() < HEADER_SIZE + (count * TICK_SIZE)) {
+        Logger::error("Truncated input recording: {}", path.string());
+        return false;
+    }
+
+    ticks.clear();
+    ticks.reserve(count);
+    const char* it = data.data() + HEADER_SIZE;
+    for (std::uint32_t i = 0; i < count; ++i, it += TICK_SIZE) {
+        InputSnapshot snapshot;
+        snapshot.buttons = getLE<std::uint32_t>(it);
+        const auto dtBits = getLE<std::uint32_t>(it + 4);
+        std::memcpy(&snapshot.dt, &dtBits, sizeof(float));
+        ticks.push_back(snapshot);
+    }
+
+    this->seed = getLE<std::uint64_t>(data.data() + 8);
+    this->flushedTicks = 0;
+    this->filePath = path;
+    this->cursor = 0;
+    this->mode = Mode::Replay;
+    Logger::info(
+        "Replaying {} ticks from {} (seed {})", count, path.string(), seed
+    );
+    return true;
+}
+
+void InputRecorder::stop() {
+    if (mode == Mode::Record) {
+        if (flush()) {
+            Logger::info(
+                "Wrote {} input ticks to {}", flushedTicks, filePath.string()
+            );
+        }
+        file.close();
+    }
+    mode = Mode::Off;
+}
+
+void InputRecorder::record(const InputSnapshot& snapshot) {
+    if (mode != Mode::Record) {
+        return;
+    }
+    ticks.push_back(snapshot);
+    if (ticks.size() >= FLUSH_TICKS) {
+        flush();
+    }
+}
+
+bool InputRecorder::next(InputSnapshot& snapshot) {
+    if (mode != Mode::Replay || cursor >= ticks.size()) {
+        return false;
+    }
+    snapshot = ticks[cursor++];
+    return true;
+}
+
+bool InputRecorder::flush() {
+    std::vector<char> data;
+    data.reserve(ticks.size() * TICK_SIZE);
+    for (const auto& snapshot : ticks) {
+        std::uint32_t dtBits = 0;
+        std::memcpy(&dtBits, &snapshot.dt, sizeof(float));
+        putLE<std::uint32_t>(data, snapshot.buttons);
+        putLE<std::uint32_t>(data, dtBits);
+    }
+    const auto count = static_cast<std::uint32_t>(flushedTicks + ticks.size());
+
+    // ticks first, the count only covers them once they are on disk
+    file.seekp(0, std::ios::end);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    std::vector<char> countBytes;
+    putLE<std::uint32_t>(countBytes, count);
+    file.seekp(HEADER_SIZE - 4);
+    file.write(countBytes.data(), 4);
+    file.flush();
+
+    if (!file.good()) {
+        Logger::error("Failed to write input recording: {}", filePath.string());
+        return false;
+    }
+    flushedTicks = count;
+    ticks.clear();
+    return true;
+}
@@ -0,0 +1,67 @@
+#include "joanna/systems/interactionindex.h"
+#include "joanna/entities/npc.h"
+
+#include <algorithm>
+
+namespace {
+float distanceSq(sf::Vector2f a, sf::Vector2f b) {
+    const sf::Vector2f delta = a - b;
+    return (delta.x * delta.x) + (delta.y * delta.y);
+}
+} // namespace
+
+void InteractionIndex::track(Interactable& interactable) {
+    tracked[interactable.getId()] = &interactable;
+    index.move(interactable.getId(), interactable.getPosition());
+}
+
+void InteractionIndex::forget(const Entity& entity) {
+    tracked.erase(entity.getId());
+    index.remove(entity.getId());
+}
+
+void InteractionIndex::clear() {
+    tracked.clear();
+    index.clear();
+    targets = InteractionTargets{};
+}
+
+void InteractionIndex::refresh(
+    sf::Vector2f playerPos, const TileManager& tileManager
+) {
+    targets.interactables.clear();
+    targets.pickups.clear();
+    targets.npcInRange = false;
+
+    candidates.clear();
+    index.query(playerPos, Interactable::INTERACTION_DISTANCE, candidates);
+    for (const uint32_t id : candidates) {
+        Interactable* interactable = tracked.at(id);
+        targets.interactables.push_back(interactable);
+        if (dynamic_cast<NPC*>(interactable) != nullptr) {
+            targets.npcInRange = true;
+        }
+    }
+    std::sort(
+        targets.interactables.begin(), targets.interactables.end(),
+        [&](const Interactable* a, const Interactable* b) {
+            return distanceSq(a->getPosition(), playerPos) <
+                   distanceSq(b->getPosition(), playerPos);
+        }
+    );
+
+    tileManager.findObjectsNear(playerPos, targets.pickups);
+    std::sort(
+        targets.pickups.begin(), targets.pickups.end(),
+        [&](uint32_t a, uint32_t b) {
+            const auto position = [&](uint32_t id) {
+                const sf::Vector2i p = tileManager.getObjectById(id)->position;
+                return sf::Vector2f(
+                    static_cast<float>(p.x), static_cast<float>(p.y)
+                );
+            };
+            return distanceSq(position(a), playerPos) <
+                   distanceSq(position(b), playerPos);
+        }
+    );
+}
@@ -0,0 +1,67 @@
+#include "joanna/systems/flagregistry.h"
+
+#include <algorithm>
+
+FlagRegistry& FlagRegistry::getInstance() {
+    static FlagRegistry instance;
+    return instance;
+}
+
+FlagRegistry::FlagRegistry() {
+    // order must match the constants in the Flags namespace
+    intern("chestOpened");
+    intern("goblinDead");
+}
+
+FlagId FlagRegistry::intern(std::string_view key) {
+    if (const auto it = ids.find(key); it != ids.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<FlagId>(names.size());
+    names.emplace_back(key);
+    ids.emplace(names.back(), id);
+    return id;
+}
+
+FlagId FlagRegistry::find(std::string_view key) const {
+    const auto it = ids.find(key);
+    return it == ids.end() ? NO_FLAG : it->second;
+}
+
+void FlagSet::set(const FlagId id) {
+    const std::size_t word = id / 64;
+    if (word >= words.size()) {
+        words.resize(word + 1, 0);
+    }
+    words[word] |= std::uint64_t{ 1 } << (id % 64);
+}
+
+bool FlagSet::any() const {
+    return std::any_of(words.begin(), words.end(), [](std::uint64_t word) {
+        return word != 0;
+    });
+}
+
+std::vector<std::string> FlagSet::toKeys() const {
+    const auto& registry = FlagRegistry::getInstance();
+    std::vector<std::string> keys;
+    for (std::size_t word = 0; word < words.size(); ++word) {
+        for (std::size_t bit = 0; bit < 64; ++bit) {
+            if (((words[word] >> bit) & 1u) != 0) {
+                keys.push_back(
+                    registry.getName(static_cast<FlagId>((word * 64) + bit))
+                );
+            }
+        }
+    }
+    return keys;
+}
+
+FlagSet FlagSet::fromKeys(const std::vector<std::string>& keys) {
+    auto& registry = FlagRegistry::getInstance();
+    FlagSet flags;
+    for (const auto& key : keys) {
+        flags.set(registry.intern(key));
+    }
+    return flags;
+}
@@ -1,4 +1,5 @@
 #include "joanna/utils/dialogue_box.h"
+#include "joanna/systems/textmetrics.h"
 #include "joanna/utils/logger.h"
 
 DialogueBox::DialogueBox(FontRenderer& fontRenderer)
@@ -11,6 +12,7 @@ DialogueBox::DialogueBox(FontRenderer& fontRenderer)
 }
 
 static const float TEXT_MAX_WIDTH = 200.0f;
+static const unsigned int TEXT_SIZE = 16; // size the dialogue is wrapped at
 
 void DialogueBox::setDialogue(
     const std::vector<std::string>& messages, const void* owner
@@ -62,10 +64,12 @@ void DialogueBox::nextLine() {
 
         currentDialogue = wrapText(rawMessage, TEXT_MAX_WIDTH);
 
-        sf::Text measuringText(fontRenderer.getFont(), currentDialogue);
-        measuringText.setCharacterSize(16);
-        
-        currentTextHeight = measuringText.getLocalBounds().size.y;
+        TextStyle style;
+        style.size = TEXT_SIZE;
+        currentTextHeight =
+            TextCache::getInstance()
+                .get(fontRenderer.getFont(), currentDialogue, style)
+                .bounds.size.y;
 
         visibleCharCount = 0;
         displayTime = 0.0f;
@@ -80,48 +84,8 @@ void DialogueBox::skipTypewriter() {
 }
 
 std::string DialogueBox::wrapText(const std::string& text, float maxWidth) {
-    std::string wrappedText;
-    std::string currentLine;
-    std::string word;
-
-    for (size_t i = 0; i < text.length(); ++i) {
-        char c = text[i];
-
-        if (c == ' ' || c == '\n' || i == text.length() - 1) {
-            if (i == text.length() - 1 && c != ' ' && c != '\n') {
-                word += c;
-            }
-
-            std::string testLine =
-                currentLine.empty() ? word : currentLine + " " + word;
-
-            sf::Text tempText(fontRenderer.getFont(), testLine);
-            tempText.setCharacterSize(16);
-            float lineWidth = tempText.getLocalBounds().size.x;
-
-            if (lineWidth > maxWidth && !currentLine.empty()) {
-                wrappedText += currentLine + "\n";
-                currentLine = word;
-            } else {
-                currentLine = testLine;
-            }
-
-            if (c == '\n') {
-                wrappedText += currentLine + "\n";
-                currentLine.clear();
-            }
-
-            word.clear();
-        } else {
-            word += c;
-        }
-    }
-
-    if (!currentLine.empty()) {
-        wrappedText += currentLine;
-    }
-
-    return wrappedText;
+    return TextMetrics::get(fontRenderer.getFont(), TEXT_SIZE)
+        .wrap(text, maxWidth);
 }
 
 void DialogueBox::updateTypewriter(float dt) {
@@ -168,6 +132,7 @@ void DialogueBox::render(sf::RenderTarget& target) {
 
     target.draw(bubbleBackground);
 
+    fontRenderer.beginBatch();
     fontRenderer.drawText(
         target, visibleText, textPosition, 24, sf::Color::Black, 0
     );
@@ -182,6 +147,7 @@ void DialogueBox::render(sf::RenderTarget& target) {
             target, indicator, indicatorPos, 16, sf::Color(100, 100, 100), 0
         );
     }
+    fontRenderer.endBatch(target);
 
     target.setView(oldView);
 }
\ No newline at end of file
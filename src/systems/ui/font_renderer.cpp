@@ -6,7 +6,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 FontRenderer::FontRenderer(const std::string& fontPath) : loaded(false) {
-    font = ResourceManager<sf::Font>::getInstance()->get(fontPath);
+    font = &ResourceManager<sf::Font>::getInstance()->get(fontPath);
     loaded = true;
 }
 
@@ -33,13 +33,25 @@ void FontRenderer::drawTextUI(
     // Set to default view (screen space)
     target.setView(target.getDefaultView());
 
-    // Draw text
+    // Draw text, right away since the view is restored below
+    const bool wasBatching = batching;
+    batching = false;
     drawTextImpl(target, text, position, size, color, options);
+    batching = wasBatching;
 
     // Restore original view
     target.setView(oldView);
 }
 
+void FontRenderer::beginBatch() {
+    batching = true;
+}
+
+void FontRenderer::endBatch(sf::RenderTarget& target) {
+    batching = false;
+    batch.draw(target);
+}
+
 void FontRenderer::drawTextImpl(
     sf::RenderTarget& target, const std::string& text,
     const sf::Vector2f& position, unsigned int size, const sf::Color& color,
@@ -50,54 +62,56 @@ void FontRenderer::drawTextImpl(
         return;
     }
 
-    sf::Text textObj(font, text);
-    textObj.setCharacterSize(size);
-    textObj.setFillColor(color);
-    textObj.setLetterSpacing(letterSpacing);
+    TextStyle style;
+    style.size = size;
+    style.letterSpacing = letterSpacing;
 
     // Apply outline if requested
     if (options & OUTLINE) {
-        textObj.setOutlineColor(sf::Color::Black);
-        textObj.setOutlineThickness(2.0f);
+        style.outlineThickness = 2.0f;
     }
 
+    const TextLayout& layout =
+        TextCache::getInstance().get(*font, text, style);
+
     // Apply alignment before drawing shadow (so shadow is properly positioned)
-    applyAlignment(textObj, position, options);
+    const sf::Vector2f offset = applyAlignment(layout, position, options);
 
-    // Draw shadow first (behind main text)
+    // Shadow first (behind main text), it has no outline
     if (options & SHADOW) {
-        sf::Text shadowText(font, text);
-        shadowText.setCharacterSize(size);
-        shadowText.setLetterSpacing(letterSpacing);
-        shadowText.setFillColor(sf::Color(0, 0, 0, 128)
+        TextStyle shadowStyle = style;
+        shadowStyle.outlineThickness = 0.f;
+        batch.add(
+            *font, shadowStyle,
+            TextCache::getInstance().get(*font, text, shadowStyle),
+            offset + sf::Vector2f(2.f, 2.f), sf::Color(0, 0, 0, 128)
         ); // Semi-transparent black
-        shadowText.setPosition(textObj.getPosition() + sf::Vector2f(2.f, 2.f));
-        applyAlignment(shadowText, shadowText.getPosition(), options);
-        target.draw(shadowText);
     }
 
-    // Draw main text
-    target.draw(textObj);
+    // Main text
+    batch.add(*font, style, layout, offset, color, sf::Color::Black);
+
+    if (!batching) {
+        batch.draw(target);
+    }
 }
 
 const sf::Font& FontRenderer::getFont() const {
-    return font;
+    return *font;
 }
 
-void FontRenderer::applyAlignment(
-    sf::Text& text, const sf::Vector2f& position, uint32_t options
+sf::Vector2f FontRenderer::applyAlignment(
+    const TextLayout& layout, const sf::Vector2f& position, uint32_t options
 ) {
-    sf::FloatRect bounds = text.getLocalBounds();
     sf::Vector2f origin(0.f, 0.f);
 
     if (options & CENTERED_X) {
-        origin.x = bounds.size.x / 2.f;
+        origin.x = layout.bounds.size.x / 2.f;
     }
 
     if (options & CENTERED_Y) {
-        origin.y = bounds.size.y / 2.f;
+        origin.y = layout.bounds.size.y / 2.f;
     }
 
-    text.setOrigin(origin);
-    text.setPosition(position);
-}
\ No newline at end of file
+    return position - origin;
+}
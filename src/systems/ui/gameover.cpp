@@ -63,13 +63,12 @@ void GameOver::render() {
     window.setView(oldView);
 }
 
-void GameOver::handleInput(const sf::Event& event) {
+void GameOver::handleInput(const InputSnapshot& input) {
     if (cooldown > 0.f) {
         return;
     }
 
-    if (event.is<sf::Event::KeyPressed>() ||
-        event.is<sf::Event::MouseButtonPressed>()) {
+    if (input.isDown(InputAction::ContinuePressed)) {
         if (onRestart) {
             Logger::info("GameOver input received, restarting...");
             onRestart();
@@ -0,0 +1,192 @@
+#include "joanna/systems/hud.h"
+
+#include "joanna/entities/itemregistry.h"
+#include "joanna/entities/player.h"
+#include "joanna/utils/quads.h"
+#include "joanna/utils/resourcemanager.h"
+
+#include <array>
+
+namespace {
+constexpr std::uint32_t HEART_GID = 3052;
+constexpr std::uint32_t HALF_HEART_GID = 3054;
+constexpr float HEART_SCALE = 3.f;
+constexpr float HEART_SPACING = 32.f;
+
+constexpr float ROW_X = -440.f;
+constexpr float ROW_Y = -415.f;
+constexpr float ROW_HEIGHT = 18.f;
+constexpr float LABEL_WIDTH = 40.f;
+constexpr sf::Vector2f SEGMENT_SIZE(8.f, 12.f);
+
+class HeartsWidget : public HudWidget {
+  protected:
+    bool bind(const Player& player) override {
+        const int value = player.getHealth();
+        const bool changed = value != health;
+        health = value;
+        return changed;
+    }
+
+    void rebuild(const sf::Vector2f viewSize) override {
+        const sf::FloatRect heart(ItemRegistry::tileRect(HEART_GID));
+        const sf::FloatRect halfHeart(ItemRegistry::tileRect(HALF_HEART_GID));
+        const sf::Vector2f start(
+            (-viewSize.x / 2) + heart.size.x, (-viewSize.y / 2) + heart.size.y
+        );
+        const sf::Vector2f size = heart.size * HEART_SCALE;
+
+        const int fullHearts = health / 20;
+        const bool showHalfHeart =
+            (health % 20) >= 10 || (health > 0 && fullHearts == 0);
+        for (int i = 0; i < fullHearts; ++i) {
+            const sf::Vector2f position(
+                start.x + (static_cast<float>(i) * HEART_SPACING), start.y
+            );
+            appendQuad(icons, { position, size }, sf::Color::White, heart);
+        }
+        if (showHalfHeart) {
+            const sf::Vector2f position(
+                start.x + (static_cast<float>(fullHearts) * HEART_SPACING),
+                start.y
+            );
+            appendQuad(icons, { position, size }, sf::Color::White, halfHeart);
+        }
+    }
+
+  private:
+    int health = -1;
+};
+
+// One row of segments, filled up to the current value
+class SegmentRowWidget : public HudWidget {
+  public:
+    using Getter = int (*)(const Player&);
+
+    // Without a max getter the row shows exactly `current` segments
+    SegmentRowWidget(
+        const float y, const Getter current, const Getter max,
+        const sf::Color active, const sf::Color empty
+    )
+        : y(y), current(current), max(max), active(active), empty(empty) {}
+
+  protected:
+    bool bind(const Player& player) override {
+        const int newValue = current(player);
+        const int newCount = max != nullptr ? max(player) : newValue;
+        const bool changed = newValue != value || newCount != count;
+        value = newValue;
+        count = newCount;
+        return changed;
+    }
+
+    void rebuild(sf::Vector2f /*viewSize*/) override {
+        float x = ROW_X + LABEL_WIDTH;
+        for (int i = 0; i < count; ++i) {
+            appendOutlinedRect(
+                shapes, { { x, y + 4.f }, SEGMENT_SIZE },
+                i < value ? active : empty, sf::Color::Black, -1.f
+            );
+            x += SEGMENT_SIZE.x;
+        }
+    }
+
+  private:
+    float y;
+    Getter current;
+    Getter max;
+    sf::Color active;
+    sf::Color empty;
+    int value = -1;
+    int count = -1;
+};
+} // namespace
+
+bool HudWidget::sync(
+    const Player& player, const sf::Vector2f viewSize, const bool relayout
+) {
+    if (!bind(player) && !relayout) {
+        return false;
+    }
+    shapes.clear();
+    icons.clear();
+    rebuild(viewSize);
+    return true;
+}
+
+Hud::Hud()
+    : tileset(&ResourceManager<sf::Texture>::getInstance()->get(
+          "assets/environment/map/tileset.png"
+      )) {
+    widgets.push_back(std::make_unique<HeartsWidget>());
+    widgets.push_back(std::make_unique<SegmentRowWidget>(
+        ROW_Y, [](const Player& p) { return p.getStats().attack; }, nullptr,
+        sf::Color(230, 50, 50), sf::Color::Transparent
+    ));
+    widgets.push_back(std::make_unique<SegmentRowWidget>(
+        ROW_Y + ROW_HEIGHT,
+        [](const Player& p) { return p.getStats().defense; }, nullptr,
+        sf::Color(50, 230, 50), sf::Color::Transparent
+    ));
+    widgets.push_back(std::make_unique<SegmentRowWidget>(
+        ROW_Y + (ROW_HEIGHT * 2),
+        [](const Player& p) { return p.getCurrentExp(); },
+        [](const Player& p) { return p.getExpToNextLevel(); },
+        sf::Color(50, 100, 255), sf::Color(60, 60, 60)
+    ));
+}
+
+void Hud::rebuildLabels(const sf::Font& font) {
+    TextStyle style;
+    style.size = 15;
+    style.outlineThickness = 1.f;
+
+    labels.clear();
+    const std::array<const char*, 3> names = { "ATK", "DEF", "EXP" };
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        labels.add(
+            font, style, TextCache::getInstance().get(font, names.at(i), style),
+            { ROW_X, ROW_Y + (static_cast<float>(i) * ROW_HEIGHT) },
+            sf::Color::White
+        );
+    }
+    labelFont = &font;
+}
+
+void Hud::draw(
+    sf::RenderTarget& target, const Player& player, const sf::Font& font
+) {
+    const sf::Vector2f size = target.getView().getSize();
+    const bool relayout = size != viewSize;
+    viewSize = size;
+
+    bool changed = false;
+    for (const auto& widget : widgets) {
+        changed |= widget->sync(player, size, relayout);
+    }
+    if (changed) {
+        shapes.clear();
+        icons.clear();
+        for (const auto& widget : widgets) {
+            shapes.insert(
+                shapes.end(), widget->getShapes().begin(),
+                widget->getShapes().end()
+            );
+            icons.insert(
+                icons.end(), widget->getIcons().begin(),
+                widget->getIcons().end()
+            );
+        }
+    }
+    if (&font != labelFont) {
+        rebuildLabels(font);
+    }
+
+    sf::RenderStates states;
+    states.texture = tileset;
+    target.draw(
+        icons.data(), icons.size(), sf::PrimitiveType::Triangles, states
+    );
+    target.draw(shapes.data(), shapes.size(), sf::PrimitiveType::Triangles);
+    labels.draw(target, true);
+}
@@ -3,11 +3,14 @@
 #include "joanna/core/renderengine.h"
 #include "joanna/core/savegamemanager.h"
 #include "joanna/utils/logger.h"
+#include "joanna/utils/random.h"
 #include "joanna/utils/resourcemanager.h"
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Window.hpp>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <utility>
 
@@ -15,6 +18,7 @@
 #include "joanna/entities/interactables/chest.h"
 #include "joanna/entities/interactables/stone.h"
 #include "joanna/entities/npc.h"
+#include "joanna/world/region.h"
 
 namespace {
 constexpr sf::Color COLOR_TEXT_NORMAL = sf::Color::Black;
@@ -24,6 +28,76 @@ constexpr sf::Color COLOR_BG_NORMAL = sf::Color(50, 50, 50, 200);
 constexpr float MENU_SPACING = 20.f;
 constexpr unsigned int FONT_SIZE_TITLE = 60;
 constexpr unsigned int FONT_SIZE_ITEM = 40;
+constexpr unsigned int FONT_SIZE_DETAILS = 24;
+constexpr float THUMBNAIL_SCALE = 6.f;
+
+// Box-filters the centre 16:9 part of the window down to an RGB thumbnail
+std::vector<std::uint8_t> captureWindowThumbnail(const sf::RenderWindow& window
+) {
+    sf::Texture texture;
+    if (!texture.resize(window.getSize())) {
+        return {};
+    }
+    texture.update(window);
+    const sf::Image image = texture.copyToImage();
+
+    constexpr unsigned width = SlotInfo::THUMBNAIL_WIDTH;
+    constexpr unsigned height = SlotInfo::THUMBNAIL_HEIGHT;
+    const sf::Vector2u size = image.getSize();
+    const unsigned cropHeight = std::min(size.y, size.x * height / width);
+    const unsigned top = (size.y - cropHeight) / 2;
+    if (size.x < width || cropHeight < height) {
+        return {};
+    }
+
+    const std::uint8_t* pixels = image.getPixelsPtr();
+    std::vector<std::uint8_t> thumbnail(width * height * 3);
+    for (unsigned ty = 0; ty < height; ++ty) {
+        const unsigned y0 = top + (ty * cropHeight / height);
+        const unsigned y1 = top + ((ty + 1) * cropHeight / height);
+        for (unsigned tx = 0; tx < width; ++tx) {
+            const unsigned x0 = tx * size.x / width;
+            const unsigned x1 = (tx + 1) * size.x / width;
+            std::array<unsigned, 3> sum{};
+            for (unsigned y = y0; y < y1; ++y) {
+                const std::uint8_t* row =
+                    pixels + (std::size_t{ y } * size.x * 4);
+                for (unsigned x = x0; x < x1; ++x) {
+                    for (std::size_t c = 0; c < 3; ++c) {
+                        sum.at(c) += row[(x * 4) + c];
+                    }
+                }
+            }
+            const unsigned count = (y1 - y0) * (x1 - x0);
+            for (std::size_t c = 0; c < 3; ++c) {
+                thumbnail[(((ty * width) + tx) * 3) + c] =
+                    static_cast<std::uint8_t>(sum.at(c) / count);
+            }
+        }
+    }
+    return thumbnail;
+}
+
+std::optional<sf::Texture>
+thumbnailTexture(const std::vector<std::uint8_t>& thumbnail) {
+    constexpr unsigned width = SlotInfo::THUMBNAIL_WIDTH;
+    constexpr unsigned height = SlotInfo::THUMBNAIL_HEIGHT;
+    if (thumbnail.size() != std::size_t{ width } * height * 3) {
+        return std::nullopt;
+    }
+    std::vector<std::uint8_t> rgba;
+    rgba.reserve(std::size_t{ width } * height * 4);
+    for (std::size_t i = 0; i < thumbnail.size(); i += 3) {
+        const auto pixel = thumbnail.begin() + static_cast<std::ptrdiff_t>(i);
+        rgba.insert(rgba.end(), pixel, pixel + 3);
+        rgba.push_back(255);
+    }
+    sf::Texture texture;
+    if (!texture.loadFromImage(sf::Image({ width, height }, rgba.data()))) {
+        return std::nullopt;
+    }
+    return texture;
+}
 } // namespace
 
 Menu::Menu(
@@ -53,6 +127,7 @@ Menu::Menu(
 
 void Menu::setOptions(const std::vector<std::string>& newOptions) {
     options = newOptions;
+    slotPreviews.clear();
     // Reset selection to first clickable item (index 1 usually, as 0 is title)
     selectedIndex = (options.size() > 1) ? 1 : 0;
     rebuildUI();
@@ -152,8 +227,7 @@ void Menu::handleInput(sf::Window& window) {
         }
 
         if (const auto* resized = event->getIf<sf::Event::Resized>()) {
-            windowManager->handleResizeEvent(resized->size);
-            rebuildUI();
+            pendingResize = resized->size; // laid out once in render()
         }
 
         // --- About Overlay Inputs ---
@@ -216,17 +290,17 @@ GameState Menu::createGameState(Player& player) {
     state.player.x = player.getPosition().x;
     state.player.y = player.getPosition().y;
     state.player.health = player.getHealth();
-    state.player.visitedInteractions = player.getVisitedInteractions();
+    state.player.visitedInteractions = player.getFlags().toKeys();
     state.player.attack = player.getStats().attack;
     state.player.defense = player.getStats().defense;
     state.player.level = player.getLevel();
     state.player.currentExp = player.getCurrentExp();
     state.player.expToNextLevel = player.getExpToNextLevel();
+    state.rngSeed = Random::getSeed();
+    state.region = regionName(regionAt(player.getPosition()));
+    state.playTime = static_cast<std::uint32_t>(game->getPlayTime());
 
-    // Save Inventory
-    for (const auto& item : player.getInventory().listItems()) {
-        state.inventory.items.push_back({ item.item.id, item.quantity });
-    }
+    state.inventory = player.getInventory().saveState();
 
     for (const auto& object : tileManager->getRenderObjects()) {
         state.map.items.push_back(
@@ -241,28 +315,18 @@ void Menu::resetNewGame() const {
     controller->getPlayer().getInventory().clear();
     controller->getPlayer().setHealth(200);
     controller->getPlayer().setPosition({ 150.f, 400.f });
-    controller->getPlayer().resetInteractions();
+    controller->getPlayer().resetFlags();
     controller->getPlayer().resetStats();
     windowManager->setCenter({ 150.f, 400.f });
+    game->setPlayTime(0.0);
     game->resetEntities();
 }
 
-void Menu::loadEntityStates(const GameState& state) {
+void Menu::loadEntityStates() {
     // move entities back to default positions or states if needed
-    const bool guard1Reset = state.player.visitedInteractions.count(
-                                 "assets/player/npc/guard1.png_Bring key"
-                             ) != 0u;
-    const bool guard2Reset = state.player.visitedInteractions.count(
-                                 "assets/player/npc/guard2.png_Bring key"
-                             ) != 0u;
-    const bool stoneLeftReset =
-        state.player.visitedInteractions.count("left") != 0u;
-    const bool stoneRightReset =
-        state.player.visitedInteractions.count("right") != 0u;
-    const bool chestOpened =
-        state.player.visitedInteractions.count("chestOpened") != 0u;
-    const bool goblinDead =
-        state.player.visitedInteractions.count("goblinDead") != 0u;
+    const Player& player = controller->getPlayer();
+    const bool chestOpened = player.hasFlag(Flags::ChestOpened);
+    const bool goblinDead = player.hasFlag(Flags::GoblinDead);
 
     for (auto it = entities->begin(); it != entities->end();) {
         auto& ptr = *it;
@@ -277,12 +341,10 @@ void Menu::loadEntityStates(const GameState& state) {
 
         // --- NPC Logic ---
         if (auto* npc = dynamic_cast<NPC*>(p)) {
-            if (npc->getUniqueSpriteId() == "assets/player/npc/guard1.png" &&
-                guard1Reset) {
-                npc->setPosition(npc->getPosition() - sf::Vector2f(50.f, 50.f));
-            }
-            if (npc->getUniqueSpriteId() == "assets/player/npc/guard2.png" &&
-                guard2Reset) {
+            const std::string sprite = npc->getUniqueSpriteId();
+            if ((sprite == "assets/player/npc/guard1.png" ||
+                 sprite == "assets/player/npc/guard2.png") &&
+                player.hasFlag(npc->flagFor("Bring key"))) {
                 npc->setPosition(npc->getPosition() - sf::Vector2f(50.f, 50.f));
             }
         }
@@ -296,8 +358,8 @@ void Menu::loadEntityStates(const GameState& state) {
 
         // --- Stone Logic ---
         if (const auto* stone = dynamic_cast<Stone*>(p)) {
-            if ((stone->getStoneId() == "left" && stoneLeftReset) ||
-                (stone->getStoneId() == "right" && stoneRightReset)) {
+            if (player.hasFlag(stone->getFlag())) {
+                controller->getInteractions().forget(*stone);
                 it = entities->erase(it);
                 itemRemoved = true;
             }
@@ -326,6 +388,7 @@ void Menu::loadEntityStates(const GameState& state) {
 bool Menu::loadGameState(
     const std::string& choice, const std::string& slotNumStr
 ) {
+    game->getSaveWorker().flush(); // the slot may still be in flight
     const SaveGameManager manager;
     game->resetEntities();
     if (choice.find("Empty") != std::string::npos) {
@@ -334,6 +397,10 @@ bool Menu::loadGameState(
     }
 
     GameState state = manager.loadGame(slotNumStr);
+    if (state.rngSeed != 0) {
+        Random::seed(state.rngSeed);
+    }
+    game->setPlayTime(state.playTime);
 
     controller->getPlayer().setPosition(
         sf::Vector2f(state.player.x, state.player.y)
@@ -353,14 +420,69 @@ bool Menu::loadGameState(
     controller->getPlayer().setCurrentExp(state.player.currentExp);
     controller->getPlayer().setExpToNextLevel(state.player.expToNextLevel);
 
-    controller->getPlayer().setInteractions(state.player.visitedInteractions);
+    controller->getPlayer().setFlags(
+        FlagSet::fromKeys(state.player.visitedInteractions)
+    );
     tileManager->loadObjectsFromSaveGame(state.map.items);
     isMenuOpen = false;
 
-    loadEntityStates(state);
+    loadEntityStates();
     return false;
 }
 
+void Menu::saveAsync(GameState state, const std::string& slotNumStr) {
+    game->getSaveWorker().submit(
+        std::move(state), slotNumStr,
+        [slotNumStr](bool success) {
+            if (success) {
+                Logger::info("Saved game to slot " + slotNumStr);
+            } else {
+                Logger::error("Saving to slot {} failed", slotNumStr);
+            }
+        }
+    );
+}
+
+void Menu::autosave() {
+    saveAsync(createGameState(controller->getPlayer()), AUTOSAVE_SLOT);
+}
+
+void Menu::showSlotOptions() {
+    game->getSaveWorker().flush(); // list what is on disk
+
+    std::vector<std::string> slots = { "1", "2", "3" };
+    if (loadingInteraction) {
+        slots.emplace_back(AUTOSAVE_SLOT); // only written by autosave()
+    }
+    const SaveGameManager manager;
+    const auto infos = manager.getSlotInfos(slots);
+
+    std::vector<std::string> slotOptions;
+    slotOptions.push_back(options.at(0));
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        std::string optionStr = "Slot ";
+        optionStr += slots[i];
+        optionStr += " - ";
+        optionStr += infos[i]
+                         ? SaveGameManager::formatTimestamp(infos[i]->savedAt)
+                         : "Empty";
+        slotOptions.push_back(optionStr);
+    }
+    slotOptions.emplace_back("Back");
+    setOptions(slotOptions);
+
+    // aligned with the options, the title comes first
+    slotPreviews.resize(options.size());
+    for (std::size_t i = 0; i < infos.size(); ++i) {
+        if (!infos[i]) {
+            continue;
+        }
+        SlotPreview& preview = slotPreviews[i + 1].emplace();
+        preview.details = SaveGameManager::describeSlot(*infos[i]);
+        preview.thumbnail = thumbnailTexture(infos[i]->thumbnail);
+    }
+}
+
 void Menu::executeSelection() {
     // Safeguard
     if (selectedIndex < 0 ||
@@ -379,44 +501,14 @@ void Menu::executeSelection() {
 
         stateToSave = createGameState(player);
 
-        std::vector<std::string> slotOptions;
-        slotOptions.push_back(options.at(0));
-
-        for (int i = 1; i <= 3; ++i) {
-            SaveGameManager manager;
-            std::string idx = std::to_string(i);
-            std::string info = manager.getSaveInfo(idx);
-            std::string optionStr = "Slot ";
-            optionStr += idx;
-            optionStr += " - ";
-            optionStr += info;
-
-            slotOptions.push_back(optionStr);
-        }
-        slotOptions.emplace_back("Back");
-
-        setOptions(slotOptions);
+        captureThumbnail = true;
+        showSlotOptions();
     } else if (choice == "New game") {
         resetNewGame();
         isMenuOpen = false;
     } else if (choice == "Load game") {
         loadingInteraction = true;
-        std::vector<std::string> slotOptions;
-        slotOptions.emplace_back(options.at(0));
-
-        for (int i = 1; i <= 3; ++i) {
-            SaveGameManager manager;
-            std::string idx = std::to_string(i);
-            std::string info = manager.getSaveInfo(idx);
-            std::string optionStr = "Slot ";
-            optionStr += idx;
-            optionStr += " - ";
-            optionStr += info;
-
-            slotOptions.push_back(optionStr);
-        }
-        slotOptions.emplace_back("Back");
-        setOptions(slotOptions);
+        showSlotOptions();
     } else if (choice == "About") {
         aboutTextContent = "Joanna's Adventure\n\n"
                            "A small RPG game.\n\n"
@@ -448,9 +540,7 @@ void Menu::executeSelection() {
                 return;
             }
         } else {
-            const SaveGameManager saveManager;
-            saveManager.saveGame(stateToSave, slotNumStr);
-            Logger::info("Saved game to slot " + choice);
+            saveAsync(std::move(stateToSave), slotNumStr);
         }
         // Maybe go back to main menu after selecting slot?
         resetToDefaultMenu();
@@ -465,13 +555,24 @@ void Menu::render(
 
     auto& window = windowManager->getWindow();
 
+    if (pendingResize) {
+        windowManager->handleResizeEvent(*pendingResize);
+        rebuildUI();
+        pendingResize.reset();
+    }
+
     // background
     windowManager->setView(windowManager->getMainView());
     window.clear();
 
     render_engine.render(
-        window, controller->getPlayer(), tileManager, entities, dialogueBox, 0.f
+        window, controller->getPlayer(), tileManager, entities, dialogueBox,
+        controller->getInteractions().getTargets(), 0.f
     );
+    if (captureThumbnail) {
+        stateToSave.thumbnail = captureWindowThumbnail(window);
+        captureThumbnail = false;
+    }
 
     // draw background
     sf::RectangleShape blackScreen(sf::Vector2f(window.getSize()));
@@ -482,6 +583,8 @@ void Menu::render(
     windowManager->setView(windowManager->getUiView());
     renderMenuOptions(window);
 
+    renderSlotPreview(window);
+
     // draw overlay if about is selected
     if (showAbout) {
         renderAboutOverlay(window);
@@ -516,6 +619,50 @@ void Menu::renderMenuOptions(sf::RenderTarget& target) {
     }
 }
 
+void Menu::renderSlotPreview(sf::RenderTarget& target) const {
+    if (showAbout || selectedIndex < 0 ||
+        selectedIndex >= static_cast<int>(slotPreviews.size()) ||
+        !slotPreviews.at(selectedIndex)) {
+        return;
+    }
+    const SlotPreview& preview = *slotPreviews.at(selectedIndex);
+    const sf::View& view = windowManager->getUiView();
+    const sf::Vector2f corner = view.getCenter() + (view.getSize() / 2.f);
+    const sf::Vector2f size(
+        static_cast<float>(SlotInfo::THUMBNAIL_WIDTH) * THUMBNAIL_SCALE,
+        static_cast<float>(SlotInfo::THUMBNAIL_HEIGHT) * THUMBNAIL_SCALE
+    );
+    const sf::Vector2f position =
+        corner - size - sf::Vector2f(MENU_SPACING, MENU_SPACING);
+
+    sf::RectangleShape frame(size);
+    frame.setPosition(position);
+    frame.setFillColor(COLOR_BG_NORMAL);
+    frame.setOutlineColor(sf::Color::White);
+    frame.setOutlineThickness(2.f);
+    target.draw(frame);
+
+    if (preview.thumbnail) {
+        sf::Sprite sprite(*preview.thumbnail);
+        sprite.setScale({ THUMBNAIL_SCALE, THUMBNAIL_SCALE });
+        sprite.setPosition(position);
+        target.draw(sprite);
+    }
+
+    sf::Text details(font);
+    details.setString(preview.details);
+    details.setCharacterSize(FONT_SIZE_DETAILS);
+    details.setFillColor(sf::Color::White);
+    details.setOutlineThickness(2.f);
+    details.setOutlineColor(sf::Color::Black);
+    const sf::FloatRect bounds = details.getLocalBounds();
+    details.setPosition(
+        { position.x + size.x - bounds.size.x,
+          position.y - bounds.size.y - MENU_SPACING }
+    );
+    target.draw(details);
+}
+
 void Menu::renderAboutOverlay(sf::RenderTarget& target) const {
     const sf::View& view = windowManager->getUiView();
     const sf::Vector2f center = view.getCenter();
@@ -560,8 +707,11 @@ void Menu::show(
 
     isMenuOpen = true;
     const auto originalView = windowManager->getWindow().getView();
+    sf::Clock frameClock;
 
     while (windowManager->getWindow().isOpen() && isMenuOpen) {
+        // keep music fades and pending tracks going behind the menu
+        audioManager.update(frameClock.restart().asSeconds());
 
         // 1. Update Input
         sf::Vector2f mousePos = getMouseWorldPos();
@@ -571,6 +721,7 @@ void Menu::show(
 
         // 2. Render
         render(render_engine, tileManager, entities, dialogueBox);
+        game->getSaveWorker().poll();
     }
 
     // Wait for keys to be released to prevent immediate re-triggering
@@ -0,0 +1,253 @@
+#include "joanna/systems/textcache.h"
+
+#include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/System/String.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace {
+// Same quad layout as sf::Text, including the 1px padding against bleeding
+void addGlyphQuad(
+    std::vector<sf::Vertex>& vertices, sf::Vector2f position,
+    const sf::Glyph& glyph
+) {
+    const float padding = 1.f;
+
+    const float left = glyph.bounds.position.x - padding;
+    const float top = glyph.bounds.position.y - padding;
+    const float right =
+        glyph.bounds.position.x + glyph.bounds.size.x + padding;
+    const float bottom =
+        glyph.bounds.position.y + glyph.bounds.size.y + padding;
+
+    const auto u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
+    const auto v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+    const auto u2 = static_cast<float>(
+                        glyph.textureRect.position.x + glyph.textureRect.size.x
+                    ) +
+                    padding;
+    const auto v2 = static_cast<float>(
+                        glyph.textureRect.position.y + glyph.textureRect.size.y
+                    ) +
+                    padding;
+
+    const sf::Color white = sf::Color::White;
+    vertices.push_back({ position + sf::Vector2f(left, top), white, { u1, v1 } }
+    );
+    vertices.push_back(
+        { position + sf::Vector2f(right, top), white, { u2, v1 } }
+    );
+    vertices.push_back(
+        { position + sf::Vector2f(left, bottom), white, { u1, v2 } }
+    );
+    vertices.push_back(
+        { position + sf::Vector2f(left, bottom), white, { u1, v2 } }
+    );
+    vertices.push_back(
+        { position + sf::Vector2f(right, top), white, { u2, v1 } }
+    );
+    vertices.push_back(
+        { position + sf::Vector2f(right, bottom), white, { u2, v2 } }
+    );
+}
+
+void hashCombine(std::size_t& seed, std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6u) + (seed >> 2u);
+}
+} // namespace
+
+TextCache& TextCache::getInstance() {
+    static TextCache instance;
+    return instance;
+}
+
+std::size_t TextCache::KeyHash::operator()(const KeyView& key) const {
+    std::size_t seed = std::hash<std::string_view>{}(key.text);
+    hashCombine(seed, std::hash<const sf::Font*>{}(key.font));
+    hashCombine(seed, std::hash<unsigned int>{}(key.style.size));
+    hashCombine(seed, std::hash<float>{}(key.style.letterSpacing));
+    hashCombine(seed, std::hash<float>{}(key.style.outlineThickness));
+    hashCombine(seed, std::hash<bool>{}(key.style.bold));
+    return seed;
+}
+
+const TextLayout& TextCache::get(
+    const sf::Font& font, std::string_view text, const TextStyle& style
+) {
+    auto it = entries.find(KeyView{ &font, style, text });
+    if (it == entries.end()) {
+        it = entries
+                 .emplace(
+                     Key{ &font, style, std::string(text) },
+                     Entry{ build(font, text, style), 0 }
+                 )
+                 .first;
+    }
+    it->second.lastUsed = frame;
+    return it->second.layout;
+}
+
+void TextCache::endFrame() {
+    ++frame;
+    if (frame < MAX_IDLE_FRAMES) {
+        return;
+    }
+    std::erase_if(entries, [this](const auto& entry) {
+        return entry.second.lastUsed + MAX_IDLE_FRAMES < frame;
+    });
+}
+
+// Mirrors sf::Text::ensureGeometryUpdate() for the styles the UI uses
+TextLayout TextCache::build(
+    const sf::Font& font, std::string_view text, const TextStyle& style
+) {
+    TextLayout layout;
+    // UTF-8, same as TextMetrics uses for wrapping
+    const sf::String string = sf::String::fromUtf8(text.begin(), text.end());
+    if (string.isEmpty()) {
+        return layout;
+    }
+
+    const unsigned int size = style.size;
+    float whitespaceWidth = font.getGlyph(U' ', size, style.bold).advance;
+    const float letterSpacing =
+        (whitespaceWidth / 3.f) * (style.letterSpacing - 1.f);
+    whitespaceWidth += letterSpacing;
+    const float lineSpacing = font.getLineSpacing(size);
+
+    float x = 0.f;
+    auto y = static_cast<float>(size);
+
+    auto minX = static_cast<float>(size);
+    auto minY = static_cast<float>(size);
+    float maxX = 0.f;
+    float maxY = 0.f;
+    char32_t prevChar = 0;
+
+    layout.fill.reserve(string.getSize() * 6);
+    if (style.outlineThickness != 0.f) {
+        layout.outline.reserve(string.getSize() * 6);
+    }
+
+    for (const char32_t curChar : string) {
+        if (curChar == U'\r') {
+            continue;
+        }
+
+        x += font.getKerning(prevChar, curChar, size, style.bold);
+        prevChar = curChar;
+
+        if (curChar == U' ' || curChar == U'\n' || curChar == U'\t') {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+
+            if (curChar == U' ') {
+                x += whitespaceWidth;
+            } else if (curChar == U'\t') {
+                x += whitespaceWidth * 4;
+            } else {
+                y += lineSpacing;
+                x = 0.f;
+            }
+
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            continue;
+        }
+
+        if (style.outlineThickness != 0.f) {
+            addGlyphQuad(
+                layout.outline, { x, y },
+                font.getGlyph(
+                    curChar, size, style.bold, style.outlineThickness
+                )
+            );
+        }
+
+        const sf::Glyph& glyph = font.getGlyph(curChar, size, style.bold);
+        addGlyphQuad(layout.fill, { x, y }, glyph);
+
+        const sf::FloatRect& bounds = glyph.bounds;
+        minX = std::min(minX, x + bounds.position.x);
+        maxX = std::max(maxX, x + bounds.position.x + bounds.size.x);
+        minY = std::min(minY, y + bounds.position.y);
+        maxY = std::max(maxY, y + bounds.position.y + bounds.size.y);
+
+        x += glyph.advance + letterSpacing;
+    }
+
+    if (style.outlineThickness != 0.f) {
+        const float outline = std::abs(std::ceil(style.outlineThickness));
+        minX -= outline;
+        maxX += outline;
+        minY -= outline;
+        maxY += outline;
+    }
+
+    layout.bounds = sf::FloatRect({ minX, minY }, { maxX - minX, maxY - minY });
+    return layout;
+}
+
+void TextBatch::add(
+    const sf::Font& font, const TextStyle& style, const TextLayout& layout,
+    sf::Vector2f offset, sf::Color fillColor, sf::Color outlineColor
+) {
+    const sf::Texture* texture = &font.getTexture(style.size);
+    auto page = std::find_if(pages.begin(), pages.end(), [&](const Page& p) {
+        return p.texture == texture;
+    });
+    if (page == pages.end()) {
+        // reuse a drained page before growing the list
+        page = std::find_if(pages.begin(), pages.end(), [](const Page& p) {
+            return p.vertices.empty();
+        });
+        if (page == pages.end()) {
+            page = pages.insert(pages.end(), Page{});
+        }
+        page->texture = texture;
+    }
+
+    // outline first so the fill of the same string ends up on top
+    const auto append = [&](const std::vector<sf::Vertex>& source,
+                            sf::Color color) {
+        for (const sf::Vertex& vertex : source) {
+            page->vertices.push_back(
+                { vertex.position + offset, color, vertex.texCoords }
+            );
+        }
+    };
+    append(layout.outline, outlineColor);
+    append(layout.fill, fillColor);
+}
+
+void TextBatch::draw(sf::RenderTarget& target, const bool keep) {
+    for (Page& page : pages) {
+        if (page.vertices.empty()) {
+            continue;
+        }
+        sf::RenderStates states;
+        states.texture = page.texture;
+        target.draw(
+            page.vertices.data(), page.vertices.size(),
+            sf::PrimitiveType::Triangles, states
+        );
+        if (!keep) {
+            page.vertices.clear();
+        }
+    }
+}
+
+void TextBatch::clear() {
+    for (Page& page : pages) {
+        page.vertices.clear();
+    }
+}
+
+bool TextBatch::empty() const {
+    return std::all_of(pages.begin(), pages.end(), [](const Page& page) {
+        return page.vertices.empty();
+    });
+}
@@ -0,0 +1,154 @@
+#include "joanna/systems/textmetrics.h"
+
+#include <SFML/System/Utf.hpp>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <tuple>
+
+namespace {
+// Decodes one code point and advances it, invalid bytes become '?'
+char32_t nextCodePoint(
+    std::string_view::const_iterator& it, std::string_view::const_iterator end
+) {
+    char32_t codePoint = 0;
+    it = sf::Utf8::decode(it, end, codePoint, U'?');
+    return codePoint;
+}
+} // namespace
+
+TextMetrics::TextMetrics(
+    const sf::Font& font, unsigned int size, float letterSpacing
+)
+    : font(&font), size(size) {
+    // same letter spacing formula as sf::Text
+    const float space = font.getGlyph(U' ', size, false).advance;
+    spacing = (space / 3.f) * (letterSpacing - 1.f);
+    whitespace = space + spacing;
+
+    for (std::size_t c = 0; c < ASCII; ++c) {
+        asciiAdvance[c] =
+            font.getGlyph(static_cast<char32_t>(c), size, false).advance +
+            spacing;
+    }
+    // NaN marks pairs that were not looked up yet
+    asciiKerning.fill(std::nanf(""));
+}
+
+const TextMetrics& TextMetrics::get(
+    const sf::Font& font, unsigned int size, float letterSpacing
+) {
+    static std::map<
+        std::tuple<const sf::Font*, unsigned int, float>,
+        std::unique_ptr<TextMetrics>>
+        instances;
+
+    auto& metrics = instances[{ &font, size, letterSpacing }];
+    if (!metrics) {
+        metrics = std::make_unique<TextMetrics>(font, size, letterSpacing);
+    }
+    return *metrics;
+}
+
+float TextMetrics::advance(char32_t c) const {
+    if (c == U' ') {
+        return whitespace;
+    }
+    if (c == U'\t') {
+        return whitespace * 4;
+    }
+    if (c < ASCII) {
+        return asciiAdvance[c];
+    }
+    auto it = otherAdvance.find(c);
+    if (it == otherAdvance.end()) {
+        it = otherAdvance
+                 .emplace(c, font->getGlyph(c, size, false).advance + spacing)
+                 .first;
+    }
+    return it->second;
+}
+
+float TextMetrics::kerning(char32_t first, char32_t second) const {
+    if (first == 0) {
+        return 0.f;
+    }
+    if (first < ASCII && second < ASCII) {
+        float& value = asciiKerning[(first * ASCII) + second];
+        if (std::isnan(value)) {
+            value = font->getKerning(first, second, size);
+        }
+        return value;
+    }
+    const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32u) |
+                              static_cast<std::uint64_t>(second);
+    auto it = otherKerning.find(key);
+    if (it == otherKerning.end()) {
+        it = otherKerning.emplace(key, font->getKerning(first, second, size))
+                 .first;
+    }
+    return it->second;
+}
+
+float TextMetrics::measure(std::string_view utf8) const {
+    float width = 0.f;
+    char32_t previous = 0;
+    for (auto it = utf8.begin(); it != utf8.end();) {
+        const char32_t c = nextCodePoint(it, utf8.end());
+        width += kerning(previous, c) + advance(c);
+        previous = c;
+    }
+    return width;
+}
+
+std::string TextMetrics::wrap(std::string_view utf8, float maxWidth) const {
+    std::string wrapped;
+    wrapped.reserve(utf8.size());
+
+    float lineWidth = 0.f;  // width of the words already on the line
+    bool lineEmpty = true;
+
+    auto it = utf8.begin();
+    while (it != utf8.end()) {
+        // measure the next word in one pass
+        const auto wordBegin = it;
+        float wordWidth = 0.f;
+        char32_t previous = 0;
+        char32_t c = 0;
+        auto wordEnd = it;
+        while (it != utf8.end()) {
+            wordEnd = it;
+            c = nextCodePoint(it, utf8.end());
+            if (c == U' ' || c == U'\n') {
+                break;
+            }
+            wordWidth += kerning(previous, c) + advance(c);
+            previous = c;
+            wordEnd = it;
+        }
+        const std::string_view word(
+            &*wordBegin, static_cast<std::size_t>(wordEnd - wordBegin)
+        );
+
+        if (!word.empty()) {
+            if (lineEmpty) {
+                lineWidth = wordWidth;
+            } else if (lineWidth + whitespace + wordWidth > maxWidth) {
+                wrapped += '\n';
+                lineWidth = wordWidth;
+            } else {
+                wrapped += ' ';
+                lineWidth += whitespace + wordWidth;
+            }
+            wrapped += word;
+            lineEmpty = false;
+        }
+
+        if (c == U'\n' && wordEnd != it) {
+            wrapped += '\n';
+            lineWidth = 0.f;
+            lineEmpty = true;
+        }
+    }
+    return wrapped;
+}
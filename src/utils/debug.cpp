@@ -1,4 +1,5 @@
 #include "joanna/utils/debug.h"
+#include "joanna/core/saveworker.h"
 #include "joanna/entities/player.h"
 #include "joanna/systems/controller.h"
 #include <fmt/format.h>
@@ -25,7 +26,7 @@ void DebugUI::processEvent(const sf::Window& window, const sf::Event& event)
 void DebugUI::update(
     const float dt, sf::RenderWindow& window, Player& player,
     GameStatus& gameStatus, CombatSystem& combatSystem, Enemy& testEnemy,
-    Controller& controller
+    Controller& controller, SaveWorker& saveWorker
 ) const {
     if constexpr (!IMGUI_ENABLED) {
         return;
@@ -59,25 +60,40 @@ void DebugUI::update(
     ImGui::InputInt("Item id", &item_id);
 
     if (ImGui::Button("Add item to inventory")) {
-        auto map = player.getInventory().mapGidToName();
-        player.getInventory().addItem(
-            Item(std::to_string(item_id), map[item_id])
+        const ItemId id = ItemRegistry::getInstance().intern(
+            static_cast<std::uint32_t>(item_id)
         );
+        player.getInventory().addItem(Item(id));
     }
     if (ImGui::Button("Add carrot to inventory")) {
-        player.getInventory().addItem(Item("691", "carrot"));
+        player.getInventory().addItem(Item(Items::Carrot));
     }
     if (ImGui::Button("Add sword to inventory")) {
-        player.getInventory().addItem(Item("3050", "sword"));
+        player.getInventory().addItem(Item(Items::Sword));
     }
     if (ImGui::Button("Add pickaxe to inventory")) {
-        player.getInventory().addItem(Item("3113", "pickaxe"));
+        player.getInventory().addItem(Item(Items::Pickaxe));
     }
 
     if (ImGui::Button("Deal 10 Damage to Player")) {
         player.takeDamage(10);
     }
 
+    static int save_slot = 1;
+    ImGui::InputInt("Save slot", &save_slot);
+    if (ImGui::Button("Convert slot to JSON")) {
+        saveWorker.flush(); // the slot may still be in flight
+        SaveGameManager().convertSlot(
+            std::to_string(save_slot), SaveFormat::Json
+        );
+    }
+    if (ImGui::Button("Convert slot to binary")) {
+        saveWorker.flush();
+        SaveGameManager().convertSlot(
+            std::to_string(save_slot), SaveFormat::Binary
+        );
+    }
+
     if (gameStatus == GameStatus::Overworld) {
         if (ImGui::Button("Start Combat")) {
             gameStatus = GameStatus::Combat;
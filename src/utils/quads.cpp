@@ -0,0 +1,49 @@
+#include "joanna/utils/quads.h"
+
+#include <cmath>
+
+void appendQuad(
+    std::vector<sf::Vertex>& vertices, const sf::FloatRect rect,
+    const sf::Color color, const sf::FloatRect texRect
+) {
+    const sf::Vector2f a = rect.position;
+    const sf::Vector2f b = rect.position + rect.size;
+    const sf::Vector2f ta = texRect.position;
+    const sf::Vector2f tb = texRect.position + texRect.size;
+    vertices.push_back({ a, color, ta });
+    vertices.push_back({ { b.x, a.y }, color, { tb.x, ta.y } });
+    vertices.push_back({ { a.x, b.y }, color, { ta.x, tb.y } });
+    vertices.push_back({ { a.x, b.y }, color, { ta.x, tb.y } });
+    vertices.push_back({ { b.x, a.y }, color, { tb.x, ta.y } });
+    vertices.push_back({ b, color, tb });
+}
+
+void appendOutlinedRect(
+    std::vector<sf::Vertex>& vertices, const sf::FloatRect rect,
+    const sf::Color fill, const sf::Color outline, const float thickness
+) {
+    const float t = std::abs(thickness);
+    sf::FloatRect outer = rect;
+    sf::FloatRect inner = rect;
+    if (thickness >= 0.f) {
+        outer = { rect.position - sf::Vector2f(t, t),
+                  rect.size + sf::Vector2f(2 * t, 2 * t) };
+    } else {
+        inner = { rect.position + sf::Vector2f(t, t),
+                  rect.size - sf::Vector2f(2 * t, 2 * t) };
+    }
+
+    if (fill.a > 0) {
+        appendQuad(vertices, inner, fill);
+    }
+    const sf::Vector2f o = outer.position;
+    const sf::Vector2f i = inner.position;
+    appendQuad(vertices, { o, { outer.size.x, t } }, outline);
+    appendQuad(
+        vertices, { { o.x, i.y + inner.size.y }, { outer.size.x, t } }, outline
+    );
+    appendQuad(vertices, { { o.x, i.y }, { t, inner.size.y } }, outline);
+    appendQuad(
+        vertices, { { i.x + inner.size.x, i.y }, { t, inner.size.y } }, outline
+    );
+}
@@ -0,0 +1,21 @@
+#include "joanna/utils/random.h"
+
+// splitmix64 finaliser, spreads nearby seeds/keys over the whole state space
+std::uint64_t Random::mix(std::uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27u)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31u);
+}
+
+void Random::seed(std::uint64_t masterSeed) {
+    Random::masterSeed = masterSeed;
+    for (std::size_t i = 0; i < streams.size(); ++i) {
+        streams.at(i) = Pcg32(mix(masterSeed + i), i);
+    }
+}
+
+Pcg32 Random::fork(RngStream id, std::uint64_t key) {
+    const auto streamIndex = static_cast<std::uint64_t>(id);
+    return Pcg32(mix(masterSeed ^ mix(key + (streamIndex << 56u))), key);
+}
@@ -0,0 +1,270 @@
+#include "joanna/world/navgrid.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+constexpr std::array<sf::Vector2i, 8> NEIGHBOURS = {
+    sf::Vector2i{ 1, 0 },  sf::Vector2i{ -1, 0 }, sf::Vector2i{ 0, 1 },
+    sf::Vector2i{ 0, -1 }, sf::Vector2i{ 1, 1 },  sf::Vector2i{ 1, -1 },
+    sf::Vector2i{ -1, 1 }, sf::Vector2i{ -1, -1 }
+};
+
+bool isDiagonal(sf::Vector2i delta) {
+    return delta.x != 0 && delta.y != 0;
+}
+
+float octile(sf::Vector2i a, sf::Vector2i b) {
+    const auto dx = static_cast<float>(std::abs(a.x - b.x));
+    const auto dy = static_cast<float>(std::abs(a.y - b.y));
+    return std::max(dx, dy) + (0.41421356f * std::min(dx, dy));
+}
+
+// min-heap ordering for std::push_heap/pop_heap
+template <typename Pair> bool greaterFirst(const Pair& a, const Pair& b) {
+    return a.first > b.first;
+}
+} // namespace
+
+void NavGrid::bake(
+    const std::vector<sf::FloatRect>& collisions, sf::Vector2f worldSize
+) {
+    width = static_cast<int>(std::ceil(worldSize.x / CELL_SIZE));
+    height = static_cast<int>(std::ceil(worldSize.y / CELL_SIZE));
+    const auto cellCount = static_cast<std::size_t>(width * height);
+
+    blocked.assign(cellCount, 0);
+    for (const auto& rect : collisions) {
+        const sf::Vector2i min = toCell(rect.position);
+        // exclusive, a rect ending on a cell border leaves that cell free
+        const sf::Vector2f end = rect.position + rect.size;
+        const sf::Vector2i max(
+            static_cast<int>(std::ceil(end.x / CELL_SIZE)),
+            static_cast<int>(std::ceil(end.y / CELL_SIZE))
+        );
+        for (int y = std::max(min.y, 0); y < std::min(max.y, height); ++y) {
+            for (int x = std::max(min.x, 0); x < std::min(max.x, width); ++x) {
+                blocked[index({ x, y })] = 1;
+            }
+        }
+    }
+
+    gScore.assign(cellCount, 0.f);
+    parent.assign(cellCount, -1);
+    visitedGen.assign(cellCount, 0);
+    closedGen.assign(cellCount, 0);
+    openHeap.clear();
+    openHeap.reserve(cellCount / 4);
+    generation = 0;
+
+    flowCost.assign(cellCount, UNREACHED);
+    flowHeap.clear();
+    flowHeap.reserve(cellCount / 4);
+    flowTarget = { -1, -1 };
+}
+
+sf::Vector2i NavGrid::toCell(sf::Vector2f position) const {
+    return { static_cast<int>(std::floor(position.x / CELL_SIZE)),
+             static_cast<int>(std::floor(position.y / CELL_SIZE)) };
+}
+
+sf::Vector2f NavGrid::cellCenter(sf::Vector2i cell) const {
+    return { (static_cast<float>(cell.x) + 0.5f) * CELL_SIZE,
+             (static_cast<float>(cell.y) + 0.5f) * CELL_SIZE };
+}
+
+bool NavGrid::isWalkable(sf::Vector2i cell) const {
+    return inBounds(cell) && blocked[index(cell)] == 0;
+}
+
+bool NavGrid::canStep(sf::Vector2i from, sf::Vector2i delta) const {
+    const sf::Vector2i to = from + delta;
+    if (!isWalkable(to)) {
+        return false;
+    }
+    // no corner cutting through diagonal gaps
+    if (isDiagonal(delta)) {
+        return isWalkable({ from.x + delta.x, from.y }) &&
+               isWalkable({ from.x, from.y + delta.y });
+    }
+    return true;
+}
+
+bool NavGrid::isSegmentWalkable(sf::Vector2f from, sf::Vector2f to) const {
+    const sf::Vector2f diff = to - from;
+    const float length = std::sqrt((diff.x * diff.x) + (diff.y * diff.y));
+    const int steps =
+        std::max(1, static_cast<int>(std::ceil(length / (CELL_SIZE * 0.5f))));
+
+    for (int i = 0; i <= steps; ++i) {
+        const float t = static_cast<float>(i) / static_cast<float>(steps);
+        if (!isWalkable(toCell(from + (diff * t)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NavGrid::findPath(
+    sf::Vector2f from, sf::Vector2f to, std::vector<sf::Vector2f>& path
+) {
+    path.clear();
+    const sf::Vector2i start = toCell(from);
+    const sf::Vector2i goal = toCell(to);
+    if (!inBounds(start) || !isWalkable(goal)) {
+        return false;
+    }
+    if (start == goal) {
+        path.push_back(to);
+        return true;
+    }
+
+    // new generation invalidates all scores of the previous query at once
+    if (++generation == 0) {
+        std::fill(visitedGen.begin(), visitedGen.end(), 0);
+        std::fill(closedGen.begin(), closedGen.end(), 0);
+        generation = 1;
+    }
+
+    const int startIndex = index(start);
+    const int goalIndex = index(goal);
+    gScore[startIndex] = 0.f;
+    parent[startIndex] = -1;
+    visitedGen[startIndex] = generation;
+
+    openHeap.clear();
+    openHeap.emplace_back(octile(start, goal), startIndex);
+
+    int expansions = 0;
+    while (!openHeap.empty() && expansions < MAX_EXPANSIONS) {
+        std::pop_heap(
+            openHeap.begin(), openHeap.end(),
+            greaterFirst<std::pair<float, int>>
+        );
+        const int current = openHeap.back().second;
+        openHeap.pop_back();
+
+        if (closedGen[current] == generation) {
+            continue; // stale heap entry
+        }
+        closedGen[current] = generation;
+        ++expansions;
+
+        if (current == goalIndex) {
+            for (int node = goalIndex; node != startIndex;
+                 node = parent[node]) {
+                path.push_back(cellCenter({ node % width, node / width }));
+            }
+            std::reverse(path.begin(), path.end());
+            path.back() = to;
+            return true;
+        }
+
+        const sf::Vector2i cell{ current % width, current / width };
+        for (const auto& delta : NEIGHBOURS) {
+            if (!canStep(cell, delta)) {
+                continue;
+            }
+            const int next = index(cell + delta);
+            if (closedGen[next] == generation) {
+                continue;
+            }
+            const float tentative =
+                gScore[current] + (isDiagonal(delta) ? 1.41421356f : 1.f);
+            if (visitedGen[next] != generation || tentative < gScore[next]) {
+                visitedGen[next] = generation;
+                gScore[next] = tentative;
+                parent[next] = current;
+                openHeap.emplace_back(
+                    tentative + octile(cell + delta, goal), next
+                );
+                std::push_heap(
+                    openHeap.begin(), openHeap.end(),
+                    greaterFirst<std::pair<float, int>>
+                );
+            }
+        }
+    }
+    return false;
+}
+
+void NavGrid::updateFlowField(sf::Vector2f target) {
+    const sf::Vector2i targetCell = toCell(target);
+    if (!isBaked() || targetCell == flowTarget) {
+        return;
+    }
+    flowTarget = targetCell;
+    std::fill(flowCost.begin(), flowCost.end(), UNREACHED);
+    if (!inBounds(targetCell)) {
+        return;
+    }
+
+    // Dijkstra with 10/14 integer costs, bounded to a window around the target
+    flowHeap.clear();
+    flowCost[index(targetCell)] = 0;
+    flowHeap.emplace_back(0, index(targetCell));
+
+    while (!flowHeap.empty()) {
+        std::pop_heap(
+            flowHeap.begin(), flowHeap.end(), greaterFirst<std::pair<int, int>>
+        );
+        const auto [cost, current] = flowHeap.back();
+        flowHeap.pop_back();
+        if (cost > flowCost[current]) {
+            continue;
+        }
+
+        const sf::Vector2i cell{ current % width, current / width };
+        for (const auto& delta : NEIGHBOURS) {
+            const sf::Vector2i nextCell = cell + delta;
+            if (std::abs(nextCell.x - targetCell.x) > FLOW_RADIUS ||
+                std::abs(nextCell.y - targetCell.y) > FLOW_RADIUS ||
+                !canStep(cell, delta)) {
+                continue;
+            }
+            const int next = index(nextCell);
+            const int nextCost = cost + (isDiagonal(delta) ? 14 : 10);
+            if (nextCost < flowCost[next]) {
+                flowCost[next] = static_cast<std::uint16_t>(nextCost);
+                flowHeap.emplace_back(nextCost, next);
+                std::push_heap(
+                    flowHeap.begin(), flowHeap.end(),
+                    greaterFirst<std::pair<int, int>>
+                );
+            }
+        }
+    }
+}
+
+sf::Vector2f NavGrid::flowDirection(sf::Vector2f position) const {
+    const sf::Vector2i cell = toCell(position);
+    if (!inBounds(cell) || cell == flowTarget) {
+        return { 0.f, 0.f };
+    }
+
+    // enemies may stand in a blocked cell (no hitbox), so only the
+    // neighbours have to be walkable
+    std::uint16_t best = flowCost[index(cell)];
+    sf::Vector2i bestCell = cell;
+    for (const auto& delta : NEIGHBOURS) {
+        const sf::Vector2i next = cell + delta;
+        if (!inBounds(next)) {
+            continue;
+        }
+        const std::uint16_t cost = flowCost[index(next)];
+        if (cost < best &&
+            (!isDiagonal(delta) || (isWalkable({ next.x, cell.y }) &&
+                                    isWalkable({ cell.x, next.y })))) {
+            best = cost;
+            bestCell = next;
+        }
+    }
+    if (bestCell == cell) {
+        return { 0.f, 0.f };
+    }
+
+    const sf::Vector2f dir = cellCenter(bestCell) - position;
+    const float length = std::sqrt((dir.x * dir.x) + (dir.y * dir.y));
+    return length > 0.001f ? dir / length : sf::Vector2f{ 0.f, 0.f };
+}
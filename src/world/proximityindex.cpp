@@ -0,0 +1,83 @@
+#include "joanna/world/proximityindex.h"
+
+#include <algorithm>
+#include <cmath>
+
+std::int64_t ProximityIndex::pack(std::int32_t x, std::int32_t y) {
+    return (static_cast<std::int64_t>(x) << 32) |
+           static_cast<std::uint32_t>(y);
+}
+
+std::int64_t ProximityIndex::cellOf(sf::Vector2f position) const {
+    return pack(
+        static_cast<std::int32_t>(std::floor(position.x / cellSize)),
+        static_cast<std::int32_t>(std::floor(position.y / cellSize))
+    );
+}
+
+void ProximityIndex::unlink(std::int64_t cell, std::uint32_t key) {
+    auto bucket = buckets.find(cell);
+    if (bucket == buckets.end()) {
+        return;
+    }
+    auto& keys = bucket->second;
+    auto it = std::find(keys.begin(), keys.end(), key);
+    if (it != keys.end()) {
+        *it = keys.back();
+        keys.pop_back();
+    }
+    if (keys.empty()) {
+        buckets.erase(bucket);
+    }
+}
+
+void ProximityIndex::move(std::uint32_t key, sf::Vector2f position) {
+    const std::int64_t cell = cellOf(position);
+    auto [it, inserted] = points.try_emplace(key, Point{ position, cell });
+    if (!inserted) {
+        it->second.position = position;
+        if (it->second.cell == cell) {
+            return;
+        }
+        unlink(it->second.cell, key);
+        it->second.cell = cell;
+    }
+    buckets[cell].push_back(key);
+}
+
+void ProximityIndex::remove(std::uint32_t key) {
+    auto it = points.find(key);
+    if (it == points.end()) {
+        return;
+    }
+    unlink(it->second.cell, key);
+    points.erase(it);
+}
+
+void ProximityIndex::clear() {
+    points.clear();
+    buckets.clear();
+}
+
+void ProximityIndex::query(
+    sf::Vector2f center, float radius, std::vector<std::uint32_t>& out
+) const {
+    const auto cx = static_cast<std::int32_t>(std::floor(center.x / cellSize));
+    const auto cy = static_cast<std::int32_t>(std::floor(center.y / cellSize));
+    const float radiusSq = radius * radius;
+
+    for (std::int32_t y = cy - 1; y <= cy + 1; ++y) {
+        for (std::int32_t x = cx - 1; x <= cx + 1; ++x) {
+            auto bucket = buckets.find(pack(x, y));
+            if (bucket == buckets.end()) {
+                continue;
+            }
+            for (const std::uint32_t key : bucket->second) {
+                const sf::Vector2f delta = points.at(key).position - center;
+                if ((delta.x * delta.x) + (delta.y * delta.y) <= radiusSq) {
+                    out.push_back(key);
+                }
+            }
+        }
+    }
+}
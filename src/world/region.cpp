@@ -0,0 +1,23 @@
+#include "joanna/world/region.h"
+
+Region regionAt(const sf::Vector2f position) {
+    if (position.x > 540.f) {
+        return Region::Underworld;
+    }
+    if (position.y < 215.f) {
+        return Region::Beach;
+    }
+    return Region::Overworld;
+}
+
+std::string_view regionName(const Region region) {
+    switch (region) {
+        case Region::Underworld:
+            return "Underworld";
+        case Region::Beach:
+            return "Beach";
+        case Region::Overworld:
+        default:
+            return "Overworld";
+    }
+}
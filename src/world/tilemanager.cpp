@@ -1,5 +1,7 @@
 #include "joanna/world/tilemanager.h"
+#include "joanna/systems/textcache.h"
 #include "joanna/utils/logger.h"
+#include "joanna/utils/random.h"
 #include "joanna/utils/resourcemanager.h"
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
@@ -7,7 +9,6 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <algorithm>
 #include <cmath>
-#include <random>
 #include <string>
 
 TileManager::TileManager(sf::RenderWindow& renderWindow)
@@ -56,6 +57,14 @@ bool TileManager::loadMap(const std::string& path) {
         }
     );
 
+    const tson::Vector2i mapSize = m_currentMap->getSize();
+    const tson::Vector2i tileSize = m_currentMap->getTileSize();
+    m_navGrid.bake(
+        m_collisionRects,
+        { static_cast<float>(mapSize.x * tileSize.x),
+          static_cast<float>(mapSize.y * tileSize.y) }
+    );
+
     return true;
 }
 
@@ -109,32 +118,37 @@ void TileManager::renderProgressBar(const std::string& message) const {
     // Update the size of the progress bar
     barProgress.setSize(sf::Vector2f(currentWidth, barSize.y));
 
-    sf::Font font = ResourceManager<sf::Font>::getInstance()->get(
+    const sf::Font& font = ResourceManager<sf::Font>::getInstance()->get(
         "assets/font/minecraft.ttf"
     );
-    sf::Text text(font);
-    sf::Text title(font);
-    text.setString(message.empty() ? "Loading..." : message);
-    title.setString("Joanna's Adventure");
-    text.setCharacterSize(18);
-    title.setCharacterSize(24);
-    text.setFillColor(sf::Color::White);
-    title.setFillColor(sf::Color::White);
-    title.setStyle(sf::Text::Bold);
-    sf::FloatRect textBounds = text.getLocalBounds();
-    sf::FloatRect titleBounds = title.getLocalBounds();
-    text.setOrigin({ textBounds.size.x / 2.f, textBounds.size.y / 2.f });
-    text.setPosition({ center.x, center.y + 40.f });
-
-    title.setOrigin({ titleBounds.size.x / 2.f, titleBounds.size.y / 2.f });
-    title.setPosition({ center.x, center.y - 75.f });
+    TextCache& cache = TextCache::getInstance();
+    TextStyle textStyle;
+    textStyle.size = 18;
+    TextStyle titleStyle;
+    titleStyle.size = 24;
+    titleStyle.bold = true;
+    const TextLayout& text = cache.get(
+        font, message.empty() ? "Loading..." : message, textStyle
+    );
+    const TextLayout& title = cache.get(font, "Joanna's Adventure", titleStyle);
+
+    TextBatch batch;
+    batch.add(
+        font, textStyle, text,
+        sf::Vector2f(center.x, center.y + 40.f) - (text.bounds.size / 2.f),
+        sf::Color::White
+    );
+    batch.add(
+        font, titleStyle, title,
+        sf::Vector2f(center.x, center.y - 75.f) - (title.bounds.size / 2.f),
+        sf::Color::White
+    );
 
     window->clear(sf::Color::Black);
 
     window->draw(barBackground);
     window->draw(barProgress);
-    window->draw(text);
-    window->draw(title);
+    batch.draw(*window);
 
     window->display();
 }
@@ -180,10 +194,9 @@ sf::FloatRect calculatePixelRect(
 void TileManager::randomlySelectItems(
     std::vector<tson::Object*> items, int count
 ) {
-    static std::random_device rd;
-    static std::mt19937 g(rd());
-
-    std::shuffle(items.begin(), items.end(), g);
+    Random::shuffle(
+        items.begin(), items.end(), Random::stream(RngStream::Loot)
+    );
 
     int countToSpawn = std::min((int)items.size(), count);
 
@@ -239,6 +252,7 @@ void TileManager::processLayer(const std::string& layerName) {
         //randomlySelectItems(pickaxes, 1);
         randomlySelectItems(mushrooms, 1);
         randomlySelectItems(healPotions, 1);
+        indexObjects();
     }
 
     if ((layer == nullptr) || layer->getType() != tson::LayerType::TileLayer) {
@@ -320,6 +334,7 @@ void TileManager::loadTexture(const std::string& imagePath) {
 void TileManager::clear() {
     m_tiles.clear();
     m_objects.clear();
+    indexObjects();
     m_collidables.clear();
     m_textures.clear();
     m_collisionRects.clear();
@@ -348,18 +363,39 @@ sf::Sprite TileManager::getTextureById(const int id) {
     return icon;
 }
 
+void TileManager::indexObjects() {
+    m_objectIndex.clear();
+    m_objectSlots.clear();
+    for (std::size_t i = 0; i < m_objects.size(); ++i) {
+        const RenderObject& object = m_objects[i];
+        m_objectIndex.move(
+            object.id, { static_cast<float>(object.position.x),
+                         static_cast<float>(object.position.y) }
+        );
+        m_objectSlots[object.id] = i;
+    }
+}
+
+const RenderObject* TileManager::getObjectById(uint32_t id) const {
+    auto it = m_objectSlots.find(id);
+    return it != m_objectSlots.end() ? &m_objects[it->second] : nullptr;
+}
+
 bool TileManager::removeObjectById(int id) {
-    auto before = m_objects.size();
-
-    m_objects.erase(
-        std::remove_if(
-            m_objects.begin(), m_objects.end(),
-            [id](const RenderObject& obj) { return obj.id == id; }
-        ),
-        m_objects.end()
-    );
+    auto it = m_objectSlots.find(static_cast<uint32_t>(id));
+    if (it == m_objectSlots.end()) {
+        return false;
+    }
 
-    return m_objects.size() < before; // true = something was removed
+    // keep the item order (it is the save order), only shift the slots behind
+    const std::size_t slot = it->second;
+    m_objects.erase(m_objects.begin() + static_cast<std::ptrdiff_t>(slot));
+    m_objectSlots.erase(it);
+    m_objectIndex.remove(static_cast<uint32_t>(id));
+    for (std::size_t i = slot; i < m_objects.size(); ++i) {
+        m_objectSlots[m_objects[i].id] = i;
+    }
+    return true;
 }
 
 void TileManager::loadObjectsFromSaveGame(
@@ -373,6 +409,7 @@ void TileManager::loadObjectsFromSaveGame(
         );
         m_objects.push_back(object);
     }
+    indexObjects();
 }
 
 void TileManager::reloadObjectsFromTileson() {
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/aischeduler.h"
+
+class AISchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        view = sf::FloatRect({ 0.f, 0.f }, { 320.f, 180.f });
+        player = { 160.f, 90.f };
+    }
+
+    void TearDown() override {
+    }
+
+    sf::FloatRect view;
+    sf::Vector2f player;
+    static constexpr float DT = 0.016f;
+};
+
+TEST_F(AISchedulerTest, ClassifiesByVisibilityAndDistance) {
+    AIScheduler scheduler;
+    scheduler.beginFrame(view, player);
+
+    EXPECT_EQ(scheduler.classify({ 300.f, 10.f }), AiTier::Active);
+    EXPECT_EQ(scheduler.classify({ 160.f, 240.f }), AiTier::Active);
+    EXPECT_EQ(scheduler.classify({ 600.f, 90.f }), AiTier::Background);
+    EXPECT_EQ(scheduler.classify({ 2000.f, 90.f }), AiTier::Dormant);
+}
+
+TEST_F(AISchedulerTest, ActiveActorsRunEveryFrame) {
+    AIScheduler scheduler;
+    for (int i = 0; i < 10; ++i) {
+        scheduler.beginFrame(view, player);
+        const AiTick tick = scheduler.schedule(1, { 100.f, 100.f }, DT);
+        EXPECT_TRUE(tick.run);
+        EXPECT_TRUE(tick.visible);
+        EXPECT_FLOAT_EQ(tick.dt, DT);
+    }
+}
+
+TEST_F(AISchedulerTest, BackgroundActorsAccumulateTime) {
+    AIScheduler::Config config;
+    config.backgroundInterval = 4;
+    AIScheduler scheduler(config);
+
+    int runs = 0;
+    int lastRun = -1;
+    float total = 0.f;
+    for (int i = 0; i < 16; ++i) {
+        scheduler.beginFrame(view, player);
+        const AiTick tick = scheduler.schedule(7, { 600.f, 90.f }, DT);
+        EXPECT_FALSE(tick.visible);
+        if (tick.run) {
+            ++runs;
+            lastRun = i;
+            total += tick.dt;
+        }
+    }
+    EXPECT_EQ(runs, 4);
+    // no frame time is lost, it is handed out on the next run
+    EXPECT_NEAR(total, static_cast<float>(lastRun + 1) * DT, 1e-4f);
+}
+
+TEST_F(AISchedulerTest, DormantActorsCatchUpOnWake) {
+    AIScheduler::Config config;
+    config.maxCatchUp = 0.5f;
+    AIScheduler scheduler(config);
+
+    for (int i = 0; i < 100; ++i) {
+        scheduler.beginFrame(view, player);
+        EXPECT_FALSE(scheduler.schedule(3, { 2000.f, 90.f }, DT).run);
+    }
+
+    scheduler.beginFrame(view, player);
+    const AiTick tick = scheduler.schedule(3, { 100.f, 90.f }, DT);
+    EXPECT_TRUE(tick.run);
+    EXPECT_FLOAT_EQ(tick.dt, 0.5f);
+}
+
+TEST_F(AISchedulerTest, SightChecksStayWithinBudget) {
+    AIScheduler::Config config;
+    config.sightBudget = 4;
+    config.sightInterval = 3;
+    AIScheduler scheduler(config);
+
+    for (int frame = 0; frame < 6; ++frame) {
+        scheduler.beginFrame(view, player);
+        int checks = 0;
+        for (std::uint32_t id = 0; id < 12; ++id) {
+            if (scheduler.schedule(id, { 100.f, 100.f }, DT).refreshSight) {
+                ++checks;
+            }
+        }
+        // 12 actors, refreshed every 3 frames, 4 per frame
+        EXPECT_EQ(checks, 4);
+    }
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "joanna/game/combat/attackcursor.h"
+#include "joanna/game/combat/attacktable.h"
+
+class AttackTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        data = nlohmann::json::parse(R"({
+            "player": {
+                "attack": { "name": "Attack", "damage": 2,
+                            "animation": "attack", "impact": 0.3,
+                            "end": 0.8, "approachOffset": -120 },
+                "roll": { "name": "Roll", "damage": 1, "animation": "roll",
+                          "impact": 0.2, "end": 0.85,
+                          "move": { "speed": 800, "targetOffset": -90 } }
+            },
+            "enemies": {
+                "slime": {
+                    "health": 60,
+                    "attacks": [
+                        { "name": "Bounce", "damage": 20,
+                          "animation": "attack", "impact": 0.3, "end": 0.7,
+                          "counter": [0.1, 0.3] }
+                    ]
+                }
+            }
+        })");
+    }
+
+    void TearDown() override {
+    }
+
+    nlohmann::json data;
+};
+
+TEST_F(AttackTableTest, CompilesAttacks) {
+    const AttackTable table = AttackTable::compile(data);
+
+    const Attack& roll = table.getPlayerAttack(PlayerAction::Roll);
+    EXPECT_EQ(roll.name, "Roll");
+    EXPECT_EQ(roll.animationState, State::Roll);
+    EXPECT_FLOAT_EQ(roll.moveSpeed, 800.f);
+    EXPECT_FLOAT_EQ(roll.moveThreshold, 5.f); // default
+    EXPECT_FALSE(roll.counterable);
+    EXPECT_EQ(roll.timelineSize, 2);
+
+    // a new enemy is data only
+    const EnemyDefinition* slime = table.findEnemy("slime");
+    ASSERT_NE(slime, nullptr);
+    EXPECT_EQ(slime->health, 60);
+    ASSERT_EQ(slime->attacks.size(), 1u);
+    EXPECT_TRUE(slime->attacks[0].counterable);
+    EXPECT_EQ(table.findEnemy("goblin"), nullptr);
+    EXPECT_THROW(table.getEnemy(EnemyType::Goblin), std::runtime_error);
+}
+
+TEST_F(AttackTableTest, TimelineIsSorted) {
+    const AttackTable table = AttackTable::compile(data);
+    const Attack& bounce = table.findEnemy("slime")->attacks[0];
+
+    ASSERT_EQ(bounce.timelineSize, 4);
+    EXPECT_EQ(bounce.timeline[0].event, AttackEvent::CounterOpen);
+    // the window closes at impact, impact comes first
+    EXPECT_EQ(bounce.timeline[1].event, AttackEvent::Impact);
+    EXPECT_EQ(bounce.timeline[2].event, AttackEvent::CounterClose);
+    EXPECT_EQ(bounce.timeline[3].event, AttackEvent::End);
+}
+
+TEST_F(AttackTableTest, CursorFiresEachEventOnce) {
+    const AttackTable table = AttackTable::compile(data);
+    AttackCursor cursor;
+    cursor.start(table.findEnemy("slime")->attacks[0]);
+
+    EXPECT_EQ(cursor.advance(0.05f), 0);
+    EXPECT_EQ(
+        cursor.advance(0.1f), AttackCursor::bit(AttackEvent::CounterOpen)
+    );
+    EXPECT_TRUE(cursor.isCounterOpen());
+
+    // a long step passes several keys at once
+    EXPECT_EQ(
+        cursor.advance(0.2f), AttackCursor::bit(AttackEvent::Impact) |
+                                  AttackCursor::bit(AttackEvent::CounterClose)
+    );
+    EXPECT_FALSE(cursor.isCounterOpen());
+    EXPECT_FALSE(cursor.isDone());
+
+    EXPECT_EQ(cursor.advance(1.f), AttackCursor::bit(AttackEvent::End));
+    EXPECT_TRUE(cursor.isDone());
+    EXPECT_EQ(cursor.advance(1.f), 0);
+}
+
+TEST_F(AttackTableTest, RejectsBadData) {
+    data["enemies"]["slime"]["attacks"][0]["animation"] = "dance";
+    EXPECT_ANY_THROW(AttackTable::compile(data));
+
+    data.erase("player");
+    EXPECT_ANY_THROW(AttackTable::compile(data));
+}
+
+TEST_F(AttackTableTest, ShippedEnemies) {
+    const AttackTable& table = AttackTable::getInstance();
+    EXPECT_EQ(table.getEnemy(EnemyType::Goblin).health, 200);
+    EXPECT_EQ(table.getEnemy(EnemyType::Goblin).attacks.size(), 2u);
+    EXPECT_EQ(table.getEnemy(EnemyType::Skeleton).health, 100);
+    EXPECT_EQ(table.getPlayerAttack(PlayerAction::Attack).damage, 2);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/audiomanifest.h"
+
+#include <filesystem>
+
+class AudioManifestTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        data = nlohmann::json::parse(R"({
+            "groups": [
+                { "name": "sfx", "volume": 0.5 },
+                { "name": "music", "volume": 1.0 }
+            ],
+            "sounds": [
+                { "name": "hit", "path": "assets/sfx/hit_.wav",
+                  "group": "sfx", "volume": 0.8, "maxInstances": 4,
+                  "priority": 3 },
+                { "name": "brr", "path": "assets/sfx/brr.wav",
+                  "load": "lazy" },
+                { "name": "beach", "path": "assets/music/beach.ogg",
+                  "group": "music", "load": "stream" },
+                { "name": "hit", "path": "assets/sfx/hit.wav" }
+            ]
+        })");
+    }
+
+    void TearDown() override {
+    }
+
+    nlohmann::json data;
+};
+
+TEST_F(AudioManifestTest, CompilesSoundsAndGroups) {
+    const AudioManifest manifest = AudioManifest::compile(data);
+    ASSERT_EQ(manifest.size(), 3u); // the duplicate is dropped
+
+    const SoundId hit = manifest.find("hit");
+    ASSERT_NE(hit, NO_SOUND);
+    EXPECT_EQ(manifest.get(hit).path, "assets/sfx/hit_.wav");
+    EXPECT_EQ(manifest.get(hit).load, SoundLoad::Preload);
+    EXPECT_EQ(manifest.get(hit).maxInstances, 4);
+    EXPECT_EQ(manifest.get(hit).priority, 3);
+    EXPECT_FLOAT_EQ(manifest.getVolume(hit), 0.4f);
+
+    const SoundId brr = manifest.find("brr");
+    ASSERT_NE(brr, NO_SOUND);
+    EXPECT_EQ(manifest.get(brr).load, SoundLoad::Lazy);
+    EXPECT_EQ(manifest.getGroup(manifest.get(brr).group).name, "sfx");
+
+    EXPECT_EQ(manifest.get(manifest.find("beach")).load, SoundLoad::Stream);
+    EXPECT_EQ(manifest.find("missing"), NO_SOUND);
+}
+
+TEST_F(AudioManifestTest, EmptyManifest) {
+    const AudioManifest manifest =
+        AudioManifest::compile(nlohmann::json::object());
+    EXPECT_EQ(manifest.size(), 0u);
+    EXPECT_EQ(manifest.find("hit"), NO_SOUND);
+}
+
+TEST_F(AudioManifestTest, ShippedManifestPointsAtFiles) {
+    const AudioManifest& manifest = AudioManifest::getInstance();
+    ASSERT_GT(manifest.size(), 0u);
+    for (SoundId id = 0; id < manifest.size(); ++id) {
+        EXPECT_TRUE(std::filesystem::exists(manifest.get(id).path))
+            << manifest.get(id).name;
+    }
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "joanna/game/combat/combatsim.h"
+
+class CombatSimTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        setup.level = 3;
+        setup.enemy = "goblin";
+        setup.canCounter = true;
+        setup.counterSkill = 0.5f;
+    }
+
+    void TearDown() override {
+    }
+
+    FightSetup setup;
+};
+
+TEST_F(CombatSimTest, DamageRules) {
+    const Attack& sword = CombatRules::playerAttack(PlayerAction::Attack);
+    EXPECT_EQ(CombatRules::damageToEnemy(sword, 10), 12);
+
+    const Attack& mining = CombatRules::enemyAttacks(EnemyType::Goblin)[0];
+    EXPECT_EQ(CombatRules::damageToPlayer(mining, 10), 40);
+    EXPECT_EQ(CombatRules::damageToPlayer(mining, 80), 0);
+
+    EXPECT_TRUE(CombatRules::inCounterWindow(mining, 0.2f));
+    EXPECT_FALSE(CombatRules::inCounterWindow(mining, 0.5f));
+    EXPECT_FALSE(CombatRules::inCounterWindow(sword, 0.f)); // not counterable
+}
+
+TEST_F(CombatSimTest, PlayerStatsFollowLevel) {
+    const Combatant player = CombatRules::player(4);
+    EXPECT_EQ(player.health, CombatRules::PLAYER_HEALTH);
+    EXPECT_EQ(player.attack, CombatRules::BASE_ATTACK + 6);
+    EXPECT_EQ(player.defense, CombatRules::BASE_DEFENSE + 3);
+}
+
+TEST_F(CombatSimTest, ItemBonusesApply) {
+    const Combatant bare = CombatRules::player(4);
+    const Combatant equipped = CombatRules::player(4, true, true);
+    EXPECT_EQ(equipped.attack, bare.attack + CombatRules::SWORD_ATTACK);
+    EXPECT_EQ(equipped.defense, bare.defense + CombatRules::SHIELD_DEFENSE);
+
+    // the simulator fights with the same stats
+    setup.canCounter = false;
+    Pcg32 first(3);
+    const FightStats bareStats = CombatSim::run(setup, 2000, first);
+    setup.hasSword = true;
+    setup.hasShield = true;
+    Pcg32 second(3);
+    const FightStats equippedStats = CombatSim::run(setup, 2000, second);
+    EXPECT_GT(equippedStats.winRate(), bareStats.winRate());
+}
+
+TEST_F(CombatSimTest, SameSeedSameResults) {
+    Pcg32 first(42);
+    Pcg32 second(42);
+    const FightStats a = CombatSim::run(setup, 500, first);
+    const FightStats b = CombatSim::run(setup, 500, second);
+    EXPECT_EQ(a.wins, b.wins);
+    EXPECT_EQ(a.turns, b.turns);
+    EXPECT_EQ(a.damageTaken, b.damageTaken);
+}
+
+TEST_F(CombatSimTest, CounteringHelps) {
+    Pcg32 rng(7);
+    setup.counterSkill = 0.f;
+    const FightStats never = CombatSim::run(setup, 2000, rng);
+    setup.counterSkill = 1.f;
+    const FightStats always = CombatSim::run(setup, 2000, rng);
+
+    EXPECT_LT(never.winRate(), always.winRate());
+    EXPECT_EQ(always.fights, 2000u);
+}
+
+TEST_F(CombatSimTest, FightEnds) {
+    Pcg32 rng(1);
+    setup.enemy = "skeleton";
+    setup.canCounter = false;
+    const FightResult result = CombatSim::fight(setup, rng);
+    EXPECT_TRUE(result.won);
+    EXPECT_LT(result.turns, CombatSim::MAX_TURNS);
+    EXPECT_GE(
+        result.damageDealt, CombatRules::enemy(EnemyType::Skeleton).health
+    );
+}
+
+TEST_F(CombatSimTest, EnemiesComeFromTheTable) {
+    const EnemyDefinition& goblin =
+        AttackTable::getInstance().getEnemy("goblin");
+    EXPECT_EQ(CombatRules::enemy(goblin).health, goblin.health);
+
+    Pcg32 rng(1);
+    setup.enemy = "dragon";
+    EXPECT_THROW(CombatSim::fight(setup, rng), std::runtime_error);
+}
+
+TEST_F(CombatSimTest, MergeAndPercentiles) {
+    FightStats stats;
+    stats.add({ true, 4, 2.f, 100, 10 });
+    FightStats other;
+    other.add({ false, 8, 4.f, 50, 200 });
+    other.add({ true, 6, 3.f, 100, 30 });
+    stats.merge(other);
+
+    EXPECT_EQ(stats.fights, 3u);
+    EXPECT_EQ(stats.wins, 2u);
+    EXPECT_DOUBLE_EQ(stats.meanDuration(), 3.0);
+    EXPECT_EQ(FightStats::percentile(stats.turns, 0.5), 6u);
+    EXPECT_EQ(FightStats::percentile(stats.damageTaken, 1.0), 200u);
+    EXPECT_DOUBLE_EQ(FightStats::mean(stats.turns), 6.0);
+}
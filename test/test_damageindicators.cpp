@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "joanna/game/combat/damageindicators.h"
+#include "joanna/utils/resourcemanager.h"
+
+class DamageIndicatorPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        font = &ResourceManager<sf::Font>::getInstance()->get(
+            "assets/font/minecraft.ttf"
+        );
+    }
+
+    void TearDown() override {
+    }
+
+    const sf::Font* font = nullptr;
+    DamageIndicatorPool pool;
+};
+
+TEST_F(DamageIndicatorPoolTest, FullRingReplacesOldest) {
+    for (int i = 0; i < 40; ++i) {
+        pool.spawn({ 0.f, 0.f }, i);
+    }
+    EXPECT_EQ(pool.size(), DamageIndicatorPool::CAPACITY);
+
+    pool.update(0.5f);
+    EXPECT_EQ(pool.size(), DamageIndicatorPool::CAPACITY);
+    pool.update(0.6f);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST_F(DamageIndicatorPoolTest, ExpiresInSpawnOrder) {
+    pool.spawn({ 0.f, 0.f }, 5);
+    pool.update(0.7f);
+    pool.spawn({ 0.f, 0.f }, 7);
+    pool.update(0.4f);
+    EXPECT_EQ(pool.size(), 1u);
+
+    pool.clear();
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST_F(DamageIndicatorPoolTest, AppendsLiveIndicators) {
+    TextBatch batch;
+    pool.appendTo(batch, *font);
+    EXPECT_TRUE(batch.empty());
+
+    pool.spawn({ 100.f, 100.f }, 12);
+    pool.spawn({ 200.f, 100.f }, 3);
+    pool.appendTo(batch, *font);
+    EXPECT_FALSE(batch.empty());
+}
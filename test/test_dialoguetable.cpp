@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/dialoguetable.h"
+
+class DialogueTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        table = DialogueTable::compile(nlohmann::json::parse(R"({
+            "Guard": [
+                { "priority": 1, "text": ["Halt!"] },
+                {
+                    "priority": 3, "id": "Bring key", "text": ["Go on."],
+                    "req": { "type": "ITEM", "id": "627", "amount": 1 },
+                    "move": [ { "x": 0, "y": -50 }, { "x": -50 } ]
+                },
+                {
+                    "priority": 2, "text": ["Thanks!"],
+                    "req": { "type": "ITEM_REMOVE", "id": "691", "amount": 5 },
+                    "reward": { "id": "627", "name": "key", "amount": 1 }
+                }
+            ],
+            "Boy": [ { "priority": 1, "id": "Bring key", "text": ["Hi"] } ]
+        })"));
+    }
+
+    void TearDown() override {
+    }
+
+    DialogueTable table;
+};
+
+TEST_F(DialogueTableTest, EntriesAreSortedByPriority) {
+    const auto entries = table.getEntries("Guard");
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].priority, 3);
+    EXPECT_EQ(entries[1].priority, 2);
+    EXPECT_EQ(entries[2].priority, 1);
+    EXPECT_TRUE(table.getEntries("Nobody").empty());
+}
+
+TEST_F(DialogueTableTest, RequirementsAreCompiled) {
+    const auto entries = table.getEntries("Guard");
+
+    EXPECT_EQ(entries[0].requirement.type, RequirementType::Item);
+    EXPECT_EQ(entries[0].requirement.item, Items::Key);
+    EXPECT_EQ(entries[0].requirement.amount, 1u);
+
+    EXPECT_EQ(entries[1].requirement.type, RequirementType::ItemRemove);
+    EXPECT_EQ(entries[1].requirement.item, Items::Carrot);
+    ASSERT_TRUE(entries[1].reward.has_value());
+    EXPECT_EQ(entries[1].reward->id, Items::Key);
+    EXPECT_EQ(entries[1].reward->name(), "key");
+
+    EXPECT_EQ(entries[2].requirement.type, RequirementType::None);
+}
+
+TEST_F(DialogueTableTest, IdsAreInternedAndMovesParsed) {
+    const auto guard = table.getEntries("Guard");
+    const auto boy = table.getEntries("Boy");
+
+    const std::uint32_t id = table.findId("Bring key");
+    ASSERT_NE(id, DialogueEntry::NO_ID);
+    EXPECT_EQ(guard[0].id, id);
+    EXPECT_EQ(boy[0].id, id);
+    EXPECT_EQ(table.getName(id), "Bring key");
+    EXPECT_EQ(guard[1].id, DialogueEntry::NO_ID);
+
+    ASSERT_TRUE(guard[0].hasMove);
+    ASSERT_EQ(guard[0].move.size(), 2u);
+    EXPECT_EQ(guard[0].move[1], sf::Vector2f(-50.f, 0.f));
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/flagregistry.h"
+
+class FlagRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+
+    void TearDown() override {
+    }
+
+    FlagRegistry& registry = FlagRegistry::getInstance();
+};
+
+TEST_F(FlagRegistryTest, BuiltinFlagsHaveFixedIds) {
+    EXPECT_EQ(registry.find("chestOpened"), Flags::ChestOpened);
+    EXPECT_EQ(registry.find("goblinDead"), Flags::GoblinDead);
+    EXPECT_EQ(registry.getName(Flags::GoblinDead), "goblinDead");
+}
+
+TEST_F(FlagRegistryTest, InternIsStable) {
+    const FlagId first = registry.intern("guard1.png_Bring key");
+    EXPECT_EQ(registry.intern(std::string("guard1.png_") + "Bring key"), first);
+    EXPECT_EQ(registry.find("never interned"), NO_FLAG);
+}
+
+TEST_F(FlagRegistryTest, SetAndTestBits) {
+    FlagSet flags;
+    EXPECT_FALSE(flags.any());
+    EXPECT_FALSE(flags.test(Flags::ChestOpened));
+    EXPECT_FALSE(flags.test(1000)); // beyond the allocated words
+
+    flags.set(Flags::ChestOpened);
+    flags.set(130);
+    EXPECT_TRUE(flags.test(Flags::ChestOpened));
+    EXPECT_TRUE(flags.test(130));
+    EXPECT_FALSE(flags.test(Flags::GoblinDead));
+    EXPECT_FALSE(flags.test(129));
+
+    flags.reset();
+    EXPECT_FALSE(flags.any());
+}
+
+TEST_F(FlagRegistryTest, KeysRoundTrip) {
+    FlagSet flags;
+    flags.set(Flags::GoblinDead);
+    flags.set(registry.intern("left"));
+
+    const std::vector<std::string> keys = flags.toKeys();
+    ASSERT_EQ(keys.size(), 2u);
+    EXPECT_EQ(keys[0], "goblinDead");
+
+    const FlagSet loaded = FlagSet::fromKeys({ "left", "goblinDead", "new" });
+    EXPECT_TRUE(loaded.test(Flags::GoblinDead));
+    EXPECT_TRUE(loaded.test(registry.find("left")));
+    EXPECT_TRUE(loaded.test(registry.find("new")));
+    EXPECT_FALSE(loaded.test(Flags::ChestOpened));
+}
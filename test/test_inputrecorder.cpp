@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/inputrecorder.h"
+
+#include <filesystem>
+
+class InputRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = std::filesystem::temp_directory_path() / "joanna_input_test.rec";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::filesystem::path path;
+};
+
+TEST_F(InputRecorderTest, SnapshotBits) {
+    InputSnapshot snapshot;
+    EXPECT_FALSE(snapshot.isDown(InputAction::Left));
+
+    snapshot.set(InputAction::Left, true);
+    snapshot.set(InputAction::CombatDodgePressed, true);
+    EXPECT_TRUE(snapshot.isDown(InputAction::Left));
+    EXPECT_TRUE(snapshot.isDown(InputAction::CombatDodgePressed));
+    EXPECT_FALSE(snapshot.isDown(InputAction::Right));
+
+    snapshot.set(InputAction::Left, false);
+    EXPECT_FALSE(snapshot.isDown(InputAction::Left));
+}
+
+TEST_F(InputRecorderTest, RecordAndReplayRoundTrip) {
+    std::vector<InputSnapshot> recorded;
+    {
+        InputRecorder recorder;
+        recorder.startRecording(path, 0xDEADBEEFCAFEull);
+        for (int i = 0; i < 100; ++i) {
+            InputSnapshot snapshot;
+            snapshot.buttons = static_cast<std::uint32_t>(i * 7919);
+            snapshot.dt = 0.016f + static_cast<float>(i) * 1e-5f;
+            recorder.record(snapshot);
+            recorded.push_back(snapshot);
+        }
+        recorder.stop();
+    }
+
+    InputRecorder replay;
+    ASSERT_TRUE(replay.startReplay(path));
+    EXPECT_EQ(replay.getSeed(), 0xDEADBEEFCAFEull);
+    EXPECT_EQ(replay.tickCount(), recorded.size());
+
+    InputSnapshot snapshot;
+    for (const auto& expected : recorded) {
+        ASSERT_TRUE(replay.next(snapshot));
+        EXPECT_EQ(snapshot.buttons, expected.buttons);
+        EXPECT_EQ(snapshot.dt, expected.dt); // bit-exact
+    }
+    EXPECT_FALSE(replay.next(snapshot));
+    EXPECT_TRUE(replay.isFinished());
+}
+
+TEST_F(InputRecorderTest, FlushesWhileRecording) {
+    InputRecorder recorder;
+    recorder.startRecording(path, 42);
+    InputSnapshot snapshot;
+    snapshot.dt = 0.016f;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        snapshot.buttons = i;
+        recorder.record(snapshot);
+    }
+    EXPECT_EQ(recorder.tickCount(), 1000u);
+
+    // read back without stop(), as after a crash
+    InputRecorder replay;
+    ASSERT_TRUE(replay.startReplay(path));
+    EXPECT_GT(replay.tickCount(), 0u);
+    EXPECT_LE(replay.tickCount(), 1000u);
+    for (std::uint32_t i = 0; i < replay.tickCount(); ++i) {
+        ASSERT_TRUE(replay.next(snapshot));
+        EXPECT_EQ(snapshot.buttons, i);
+    }
+}
+
+TEST_F(InputRecorderTest, RejectsInvalidFile) {
+    InputRecorder replay;
+    EXPECT_FALSE(replay.startReplay(path));
+    EXPECT_EQ(replay.getMode(), InputRecorder::Mode::Off);
+}
@@ -9,8 +9,14 @@ protected:
     void TearDown() override {
     }
 
-    Item createItem(const std::string& id, bool stackable = true) {
-        return {id, "Test Item " + id, stackable};
+    static ItemId id(std::uint32_t gid) {
+        return ItemRegistry::getInstance().intern(
+            gid, "Test Item " + std::to_string(gid)
+        );
+    }
+
+    static Item createItem(std::uint32_t gid, bool stackable = true) {
+        return { id(gid), stackable };
     }
 };
 
@@ -24,24 +30,24 @@ TEST_F(InventoryTest, InitialStateIsEmpty) {
 
 TEST_F(InventoryTest, AddStackableItem) {
     Inventory inv(5);
-    Item apple = createItem("101", true);
+    Item apple = createItem(101, true);
 
     uint32_t added = inv.addItem(apple, 5);
 
     EXPECT_EQ(added, 5);
     EXPECT_EQ(inv.slotsUsed(), 1);
-    EXPECT_EQ(inv.getQuantity("101"), 5);
+    EXPECT_EQ(inv.getQuantity(id(101)), 5);
 
     added = inv.addItem(apple, 3);
 
     EXPECT_EQ(added, 3);
     EXPECT_EQ(inv.slotsUsed(), 1);
-    EXPECT_EQ(inv.getQuantity("101"), 8);
+    EXPECT_EQ(inv.getQuantity(id(101)), 8);
 }
 
 TEST_F(InventoryTest, AddUnstackableItem) {
     Inventory inv(5);
-    Item sword = createItem("3050", false);
+    Item sword = createItem(3050, false);
 
     inv.addItem(sword, 1);
     EXPECT_EQ(inv.slotsUsed(), 1);
@@ -54,9 +60,9 @@ TEST_F(InventoryTest, AddUnstackableItem) {
 
 TEST_F(InventoryTest, CapacityLimitReached) {
     Inventory inv(2);
-    Item itemA = createItem("1", false);
-    Item itemB = createItem("2", false);
-    Item itemC = createItem("3", false);
+    Item itemA = createItem(1, false);
+    Item itemB = createItem(2, false);
+    Item itemC = createItem(3, false);
 
     EXPECT_EQ(inv.addItem(itemA, 1), 1);
     EXPECT_EQ(inv.addItem(itemB, 1), 1);
@@ -69,116 +75,143 @@ TEST_F(InventoryTest, CapacityLimitReached) {
 
 TEST_F(InventoryTest, RemoveItem) {
     Inventory inv(10);
-    Item potion = createItem("1", true);
+    Item potion = createItem(1, true);
 
     inv.addItem(potion, 10);
 
-    uint32_t removed = inv.removeItem("1", 4);
+    uint32_t removed = inv.removeItem(id(1), 4);
     EXPECT_EQ(removed, 4);
-    EXPECT_EQ(inv.getQuantity("1"), 6);
+    EXPECT_EQ(inv.getQuantity(id(1)), 6);
 
-    removed = inv.removeItem("1", 10);
+    removed = inv.removeItem(id(1), 10);
     EXPECT_EQ(removed, 6);
-    EXPECT_EQ(inv.getQuantity("1"), 0);
+    EXPECT_EQ(inv.getQuantity(id(1)), 0);
     EXPECT_EQ(inv.slotsUsed(), 0);
 }
 
 TEST_F(InventoryTest, SelectionNavigation) {
     Inventory inv(10);
-    inv.addItem(createItem("1"), 1);
-    inv.addItem(createItem("2"), 1);
-    inv.addItem(createItem("3"), 1);
+    inv.addItem(createItem(1), 1);
+    inv.addItem(createItem(2), 1);
+    inv.addItem(createItem(3), 1);
 
     EXPECT_EQ(inv.getSelectedSlotIndex(), 0);
-    EXPECT_EQ(inv.getSelectedItemId(), "1");
+    EXPECT_EQ(inv.getSelectedItemId(), id(1));
 
     inv.selectNext();
     EXPECT_EQ(inv.getSelectedSlotIndex(), 1);
-    EXPECT_EQ(inv.getSelectedItemId(), "2");
+    EXPECT_EQ(inv.getSelectedItemId(), id(2));
 
     inv.selectNext();
     EXPECT_EQ(inv.getSelectedSlotIndex(), 2);
-    EXPECT_EQ(inv.getSelectedItemId(), "3");
+    EXPECT_EQ(inv.getSelectedItemId(), id(3));
 
     // Wrap Around
     inv.selectNext();
     EXPECT_EQ(inv.getSelectedSlotIndex(), 0);
-    EXPECT_EQ(inv.getSelectedItemId(), "1");
+    EXPECT_EQ(inv.getSelectedItemId(), id(1));
 
     inv.selectPrevious();
     EXPECT_EQ(inv.getSelectedSlotIndex(), 2);
-    EXPECT_EQ(inv.getSelectedItemId(), "3");
+    EXPECT_EQ(inv.getSelectedItemId(), id(3));
 }
 
 TEST_F(InventoryTest, SelectionClampingOnRemoval) {
     Inventory inv(10);
-    inv.addItem(createItem("1"), 1);
-    inv.addItem(createItem("2"), 1);
+    inv.addItem(createItem(1), 1);
+    inv.addItem(createItem(2), 1);
 
     inv.selectSlot(1);
-    EXPECT_EQ(inv.getSelectedItemId(), "2");
+    EXPECT_EQ(inv.getSelectedItemId(), id(2));
 
-    inv.removeItem("2", 1);
+    inv.removeItem(id(2), 1);
 
     EXPECT_EQ(inv.getSelectedSlotIndex(), 0);
-    EXPECT_EQ(inv.getSelectedItemId(), "1");
+    EXPECT_EQ(inv.getSelectedItemId(), id(1));
 
-    inv.removeItem("1", 1);
+    inv.removeItem(id(1), 1);
 
     EXPECT_EQ(inv.slotsUsed(), 0);
-    EXPECT_EQ(inv.getSelectedItemId(), "");
+    EXPECT_EQ(inv.getSelectedItemId(), NO_ITEM);
 }
 
 TEST_F(InventoryTest, SelectionSlotValid) {
     Inventory inv(10);
-    inv.addItem(createItem("1"), 1);
-    inv.addItem(createItem("2"), 1);
+    inv.addItem(createItem(1), 1);
+    inv.addItem(createItem(2), 1);
 
     inv.selectSlot(1);
-    EXPECT_EQ(inv.getSelectedItemId(), "2");
+    EXPECT_EQ(inv.getSelectedItemId(), id(2));
     EXPECT_EQ(inv.getSelectedSlotIndex(), 1);
 }
 
 TEST_F(InventoryTest, SelectionSlotInvalid) {
     Inventory inv(10);
-    inv.addItem(createItem("1"), 1);
-    inv.addItem(createItem("2"), 1);
+    inv.addItem(createItem(1), 1);
+    inv.addItem(createItem(2), 1);
 
     inv.selectSlot(4);
-    EXPECT_EQ(inv.getSelectedItemId(), "1");
+    EXPECT_EQ(inv.getSelectedItemId(), id(1));
     EXPECT_EQ(inv.getSelectedSlotIndex(), 0);
 }
 
 TEST_F(InventoryTest, AddInvisibleItem) {
     Inventory inv(10);
-    inv.addItem(createItem("1"), 1);
-    inv.addItem(createItem("2"), 1);
+    inv.addItem(createItem(1), 1);
+    inv.addItem(createItem(2), 1);
 
     EXPECT_EQ(inv.slotsUsed(), 2);
 
-    const auto item = Item("1056", "invisible", true);
-    inv.addItem(item, 1);
+    const ItemId invisible =
+        ItemRegistry::getInstance().intern(1056, "invisible");
+    inv.addItem(Item(invisible), 1);
 
     EXPECT_EQ(inv.slotsUsed(), 3);
-    EXPECT_EQ(inv.listItems().at(2).item.name, "invisible");
+    EXPECT_EQ(inv.listItems().at(2).item.name(), "invisible");
 }
 
 TEST_F(InventoryTest, CheckOrderWithInvisibleItem) {
     Inventory inv(10);
 
-    const auto item = Item("3055", "counterAttack", true);
+    const auto item = Item(Items::CounterAttack);
     inv.addItem(item, 1);
 
     EXPECT_EQ(inv.slotsUsed(), 1);
-    EXPECT_EQ(inv.listItems().at(0).item.name, "counterAttack");
+    EXPECT_EQ(inv.listItems().at(0).item.name(), "counterAttack");
 
-    inv.addItem(createItem("1"), 1);
+    inv.addItem(createItem(1), 1);
     EXPECT_EQ(inv.slotsUsed(), 2);
-    EXPECT_EQ(inv.listItems().at(0).item.id, "1");
-    EXPECT_EQ(inv.listItems().at(1).item.name, "counterAttack");
-
-    inv.addItem(createItem("2"), 1);
-    EXPECT_EQ(inv.listItems().at(0).item.id, "1");
-    EXPECT_EQ(inv.listItems().at(1).item.id, "2");
-    EXPECT_EQ(inv.listItems().at(2).item.name, "counterAttack");
-}
\ No newline at end of file
+    EXPECT_EQ(inv.listItems().at(0).item.id, id(1));
+    EXPECT_EQ(inv.listItems().at(1).item.name(), "counterAttack");
+
+    inv.addItem(createItem(2), 1);
+    EXPECT_EQ(inv.listItems().at(0).item.id, id(1));
+    EXPECT_EQ(inv.listItems().at(1).item.id, id(2));
+    EXPECT_EQ(inv.listItems().at(2).item.name(), "counterAttack");
+}
+
+TEST_F(InventoryTest, IndexesFollowAddAndRemove) {
+    Inventory inv(10);
+    inv.addItem(Item(Items::PiratToken), 1);
+    inv.addItem(createItem(1, false), 2);
+    inv.addItem(createItem(1, false), 3);
+    inv.addItem(Item(Items::Pickaxe), 1);
+
+    EXPECT_TRUE(inv.hasItem(Items::PiratToken));
+    EXPECT_TRUE(inv.hasItem(Items::Pickaxe));
+    EXPECT_FALSE(inv.hasItem(Items::Sword));
+    EXPECT_EQ(inv.getQuantity(id(1)), 5);
+    EXPECT_EQ(inv.listItems().back().item.id, Items::PiratToken);
+
+    // drains the slots holding the item in order
+    EXPECT_EQ(inv.removeItem(id(1), 4), 4);
+    EXPECT_EQ(inv.getQuantity(id(1)), 1);
+    EXPECT_EQ(inv.slotsUsed(), 3);
+    EXPECT_EQ(inv.removeItem(id(1), 3), 1);
+    EXPECT_FALSE(inv.hasItem(id(1)));
+
+    inv.removeItem(Items::PiratToken, 1);
+    EXPECT_FALSE(inv.hasItem(Items::PiratToken));
+    EXPECT_EQ(inv.slotsUsed(), 1);
+    EXPECT_EQ(inv.getSelectedItemId(), Items::Pickaxe);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "joanna/entities/inventory.h"
+
+class ItemRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+
+    void TearDown() override {
+    }
+
+    ItemRegistry& registry = ItemRegistry::getInstance();
+};
+
+TEST_F(ItemRegistryTest, BuiltinItemsHaveFixedIds) {
+    EXPECT_EQ(registry.findByGid(691), Items::Carrot);
+    EXPECT_EQ(registry.findByGid(3113), Items::Pickaxe);
+    EXPECT_EQ(registry.get(Items::Sword).name, "sword");
+    EXPECT_TRUE(registry.get(Items::CounterAttack).invisible);
+    EXPECT_FALSE(registry.get(Items::Heal).invisible);
+}
+
+TEST_F(ItemRegistryTest, InternIsStable) {
+    const ItemId first = registry.intern(4242, "relic");
+    const ItemId second = registry.intern(4242, "other name");
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(registry.get(first).name, "relic");
+    EXPECT_EQ(registry.get(first).gid, 4242u);
+    EXPECT_FALSE(registry.findByGid(4243).has_value());
+}
+
+TEST_F(ItemRegistryTest, StringRoundTrip) {
+    EXPECT_EQ(registry.toString(Items::Grade), "630");
+    EXPECT_EQ(registry.fromString("630"), Items::Grade);
+
+    const ItemId unknown = registry.fromString("4300");
+    EXPECT_EQ(registry.toString(unknown), "4300");
+}
+
+TEST_F(ItemRegistryTest, IconRectFromTileset) {
+    const sf::IntRect rect = registry.get(Items::Carrot).iconRect;
+    EXPECT_EQ(rect.position.x, (691 % 64) * 16);
+    EXPECT_EQ(rect.position.y, (691 / 64) * 16);
+    EXPECT_EQ(rect.size.x, 16);
+}
+
+TEST_F(ItemRegistryTest, InventorySaveStateUsesGids) {
+    Inventory inv(10);
+    inv.addItem(Item(Items::Sword), 1);
+    inv.addItem(Item(Items::Carrot), 3);
+
+    const InventoryState state = inv.saveState();
+    ASSERT_EQ(state.items.size(), 2u);
+    EXPECT_EQ(state.items[0].id, "3050");
+    EXPECT_EQ(state.items[1].quantity, 3u);
+
+    Inventory loaded(10);
+    loaded.loadState(state);
+    EXPECT_EQ(loaded.getQuantity(Items::Carrot), 3u);
+    EXPECT_TRUE(loaded.hasItem(Items::Sword));
+}
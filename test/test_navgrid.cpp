@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "joanna/world/navgrid.h"
+
+#include <vector>
+
+class NavGridTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 20x20 cells with a vertical wall at x = 10 leaving a gap at the top
+        walls.emplace_back(
+            sf::Vector2f(10 * NavGrid::CELL_SIZE, 2 * NavGrid::CELL_SIZE),
+            sf::Vector2f(NavGrid::CELL_SIZE, 18 * NavGrid::CELL_SIZE)
+        );
+        grid.bake(walls, { 20 * NavGrid::CELL_SIZE, 20 * NavGrid::CELL_SIZE });
+    }
+
+    void TearDown() override {
+    }
+
+    std::vector<sf::FloatRect> walls;
+    NavGrid grid;
+};
+
+TEST_F(NavGridTest, BakeMarksCollisions) {
+    EXPECT_TRUE(grid.isBaked());
+    EXPECT_FALSE(grid.isWalkable({ 10, 5 }));
+    EXPECT_TRUE(grid.isWalkable({ 10, 0 }));
+    EXPECT_TRUE(grid.isWalkable({ 3, 5 }));
+    EXPECT_FALSE(grid.isWalkable({ -1, 0 }));
+}
+
+TEST_F(NavGridTest, CellsNextToObstacleStayWalkable) {
+    EXPECT_TRUE(grid.isWalkable({ 11, 5 }));
+    EXPECT_TRUE(grid.isWalkable({ 9, 5 }));
+    EXPECT_TRUE(grid.isWalkable({ 10, 1 }));
+
+    // a one cell gap between two blocks stays open
+    const std::vector<sf::FloatRect> blocks = {
+        { { 0.f, 0.f }, { 4 * NavGrid::CELL_SIZE, 4 * NavGrid::CELL_SIZE } },
+        { { 5 * NavGrid::CELL_SIZE, 0.f },
+          { 4 * NavGrid::CELL_SIZE, 4 * NavGrid::CELL_SIZE } }
+    };
+    NavGrid doorway;
+    doorway.bake(blocks, { 10 * NavGrid::CELL_SIZE, 10 * NavGrid::CELL_SIZE });
+    EXPECT_FALSE(doorway.isWalkable({ 3, 3 }));
+    EXPECT_TRUE(doorway.isWalkable({ 4, 2 }));
+    EXPECT_TRUE(doorway.isWalkable({ 3, 4 }));
+    EXPECT_FALSE(doorway.isWalkable({ 5, 3 }));
+}
+
+TEST_F(NavGridTest, SegmentThroughWallIsBlocked) {
+    const sf::Vector2f left = grid.cellCenter({ 5, 15 });
+    const sf::Vector2f right = grid.cellCenter({ 15, 15 });
+    EXPECT_FALSE(grid.isSegmentWalkable(left, right));
+    EXPECT_TRUE(grid.isSegmentWalkable(left, grid.cellCenter({ 5, 3 })));
+}
+
+TEST_F(NavGridTest, FindPathRoutesAroundWall) {
+    const sf::Vector2f from = grid.cellCenter({ 5, 15 });
+    const sf::Vector2f to = grid.cellCenter({ 15, 15 });
+
+    std::vector<sf::Vector2f> path;
+    ASSERT_TRUE(grid.findPath(from, to, path));
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(grid.toCell(path.back()), grid.toCell(to));
+
+    sf::Vector2f previous = from;
+    for (const auto& point : path) {
+        EXPECT_TRUE(grid.isWalkable(grid.toCell(point)));
+        EXPECT_TRUE(grid.isSegmentWalkable(previous, point));
+        previous = point;
+    }
+
+    // arena reuse: a second query gives the same answer
+    std::vector<sf::Vector2f> again;
+    ASSERT_TRUE(grid.findPath(from, to, again));
+    EXPECT_EQ(again.size(), path.size());
+}
+
+TEST_F(NavGridTest, FlowFieldLeadsTowardsTarget) {
+    const sf::Vector2f target = grid.cellCenter({ 15, 15 });
+    grid.updateFlowField(target);
+
+    // walking the field from behind the wall must reach the target cell
+    sf::Vector2f position = grid.cellCenter({ 5, 15 });
+    for (int step = 0; step < 200; ++step) {
+        const sf::Vector2f dir = grid.flowDirection(position);
+        if (dir.x == 0.f && dir.y == 0.f) {
+            break;
+        }
+        position += dir * (NavGrid::CELL_SIZE * 0.5f);
+        ASSERT_TRUE(grid.isWalkable(grid.toCell(position)));
+    }
+    EXPECT_EQ(grid.toCell(position), grid.toCell(target));
+}
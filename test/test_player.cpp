@@ -51,11 +51,11 @@ TEST_F(PlayerTest, AddItemToInventory) {
         {0.f, 0.f}
     );
 
-    Item potion("1330", "Health Potion", true);
+    Item potion(Items::Heal);
 
     player.addItemToInventory(potion, 3);
 
-    EXPECT_EQ(player.getInventory().getQuantity("1330"), 3);
+    EXPECT_EQ(player.getInventory().getQuantity(Items::Heal), 3);
 }
 
 TEST_F(PlayerTest, SetHealth) {
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "joanna/world/proximityindex.h"
+
+#include <algorithm>
+#include <vector>
+
+class ProximityIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+
+    void TearDown() override {
+    }
+
+    static std::vector<std::uint32_t> sorted(std::vector<std::uint32_t> keys) {
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    ProximityIndex index{ 16.f };
+};
+
+TEST_F(ProximityIndexTest, QueryReturnsOnlyKeysInRadius) {
+    index.move(1, { 10.f, 10.f });
+    index.move(2, { 20.f, 10.f });
+    index.move(3, { 40.f, 10.f });
+    index.move(4, { -3.f, 10.f }); // negative coordinates use their own cell
+
+    std::vector<std::uint32_t> out;
+    index.query({ 12.f, 10.f }, 16.f, out);
+    EXPECT_EQ(sorted(out), (std::vector<std::uint32_t>{ 1, 2, 4 }));
+}
+
+TEST_F(ProximityIndexTest, MoveUpdatesBuckets) {
+    index.move(1, { 0.f, 0.f });
+    index.move(1, { 100.f, 100.f });
+    EXPECT_EQ(index.size(), 1u);
+
+    std::vector<std::uint32_t> out;
+    index.query({ 0.f, 0.f }, 16.f, out);
+    EXPECT_TRUE(out.empty());
+
+    index.query({ 100.f, 95.f }, 16.f, out);
+    EXPECT_EQ(out, (std::vector<std::uint32_t>{ 1 }));
+}
+
+TEST_F(ProximityIndexTest, RemoveAndClear) {
+    index.move(1, { 0.f, 0.f });
+    index.move(2, { 1.f, 1.f });
+    index.remove(1);
+    index.remove(42); // unknown keys are ignored
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_TRUE(index.contains(2));
+
+    std::vector<std::uint32_t> out;
+    index.query({ 0.f, 0.f }, 16.f, out);
+    EXPECT_EQ(out, (std::vector<std::uint32_t>{ 2 }));
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0u);
+}
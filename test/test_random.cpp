@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "joanna/utils/random.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+class RandomTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Random::seed(1234);
+    }
+
+    void TearDown() override {
+    }
+};
+
+TEST_F(RandomTest, SameSeedSameSequence) {
+    Pcg32 a(42);
+    Pcg32 b(42);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(a(), b());
+    }
+}
+
+TEST_F(RandomTest, ReseedingRestartsStreams) {
+    std::vector<std::uint32_t> first;
+    for (int i = 0; i < 16; ++i) {
+        first.push_back(Random::stream(RngStream::Spawns)());
+    }
+
+    Random::seed(1234);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(Random::stream(RngStream::Spawns)(), first.at(i));
+    }
+}
+
+TEST_F(RandomTest, StreamsAreIndependent) {
+    Random::seed(99);
+    const auto spawn = Random::stream(RngStream::Spawns)();
+
+    // drawing from another stream must not shift the spawn stream
+    Random::seed(99);
+    for (int i = 0; i < 100; ++i) {
+        Random::stream(RngStream::Loot)();
+    }
+    EXPECT_EQ(Random::stream(RngStream::Spawns)(), spawn);
+}
+
+TEST_F(RandomTest, ForkDependsOnKey) {
+    Pcg32 a = Random::fork(RngStream::EnemyAI, 1);
+    Pcg32 b = Random::fork(RngStream::EnemyAI, 1);
+    Pcg32 c = Random::fork(RngStream::EnemyAI, 2);
+
+    const auto va = a();
+    EXPECT_EQ(va, b());
+    EXPECT_NE(va, c());
+}
+
+TEST_F(RandomTest, BoundsAreRespected) {
+    Pcg32 rng(7);
+    for (int i = 0; i < 10000; ++i) {
+        EXPECT_LT(rng.nextBelow(360), 360u);
+
+        const int v = rng.range(-3, 3);
+        EXPECT_GE(v, -3);
+        EXPECT_LE(v, 3);
+
+        const float f = rng.nextFloat();
+        EXPECT_GE(f, 0.f);
+        EXPECT_LT(f, 1.f);
+    }
+}
+
+TEST_F(RandomTest, ShuffleIsPermutation) {
+    std::vector<int> values(50);
+    std::iota(values.begin(), values.end(), 0);
+
+    Pcg32 rng(3);
+    Random::shuffle(values.begin(), values.end(), rng);
+
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(sorted.at(i), i);
+    }
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "joanna/core/savecodec.h"
+
+class SaveCodecTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        state.player.health = 140;
+        state.player.x = 150.5f;
+        state.player.y = -400.25f;
+        state.player.attack = 13;
+        state.player.defense = 7;
+        state.player.level = 3;
+        state.player.currentExp = 12;
+        state.player.expToNextLevel = 40;
+        state.player.visitedInteractions = { "chestOpened", "left",
+                                             "guard1.png_Bring key" };
+        state.inventory.items = { { "3050", 1 }, { "691", 12 }, { "3055", 1 } };
+        for (std::uint32_t i = 0; i < 200; ++i) {
+            state.map.items.push_back(
+                { i, 691 + (i % 4), static_cast<int>(i) * 16, -3 }
+            );
+        }
+        state.rngSeed = 0xDEADBEEFCAFEull;
+    }
+
+    void TearDown() override {
+    }
+
+    static void expectEqual(const GameState& a, const GameState& b) {
+        EXPECT_EQ(a.player.health, b.player.health);
+        EXPECT_EQ(a.player.x, b.player.x); // bit-exact
+        EXPECT_EQ(a.player.y, b.player.y);
+        EXPECT_EQ(a.player.attack, b.player.attack);
+        EXPECT_EQ(a.player.defense, b.player.defense);
+        EXPECT_EQ(a.player.level, b.player.level);
+        EXPECT_EQ(a.player.currentExp, b.player.currentExp);
+        EXPECT_EQ(a.player.expToNextLevel, b.player.expToNextLevel);
+        EXPECT_EQ(a.player.visitedInteractions, b.player.visitedInteractions);
+        ASSERT_EQ(a.inventory.items.size(), b.inventory.items.size());
+        for (std::size_t i = 0; i < a.inventory.items.size(); ++i) {
+            EXPECT_EQ(a.inventory.items[i].id, b.inventory.items[i].id);
+            EXPECT_EQ(
+                a.inventory.items[i].quantity, b.inventory.items[i].quantity
+            );
+        }
+        ASSERT_EQ(a.map.items.size(), b.map.items.size());
+        for (std::size_t i = 0; i < a.map.items.size(); ++i) {
+            EXPECT_EQ(a.map.items[i].id, b.map.items[i].id);
+            EXPECT_EQ(a.map.items[i].gid, b.map.items[i].gid);
+            EXPECT_EQ(a.map.items[i].x, b.map.items[i].x);
+            EXPECT_EQ(a.map.items[i].y, b.map.items[i].y);
+        }
+        EXPECT_EQ(a.rngSeed, b.rngSeed);
+    }
+
+    GameState state;
+};
+
+TEST_F(SaveCodecTest, BinaryRoundTrip) {
+    const std::vector<char> data = SaveCodec::encodeBinary(state);
+    const auto decoded = SaveCodec::decodeBinary(data);
+    ASSERT_TRUE(decoded.has_value());
+    expectEqual(state, *decoded);
+
+    // smaller than the pretty-printed JSON
+    EXPECT_LT(data.size(), SaveCodec::encodeJson(state).size() / 4);
+}
+
+TEST_F(SaveCodecTest, EmptyStateRoundTrip) {
+    const auto decoded = SaveCodec::decodeBinary(SaveCodec::encodeBinary({}));
+    ASSERT_TRUE(decoded.has_value());
+    expectEqual(GameState{}, *decoded);
+}
+
+TEST_F(SaveCodecTest, RejectsCorruptedData) {
+    std::vector<char> data = SaveCodec::encodeBinary(state);
+
+    std::vector<char> flipped = data;
+    flipped[flipped.size() / 2] ^= 0x10;
+    EXPECT_FALSE(SaveCodec::decodeBinary(flipped).has_value());
+
+    std::vector<char> truncated(data.begin(), data.end() - 5);
+    EXPECT_FALSE(SaveCodec::decodeBinary(truncated).has_value());
+
+    std::vector<char> otherVersion = data;
+    otherVersion[4] = static_cast<char>(SaveCodec::VERSION + 1);
+    EXPECT_FALSE(SaveCodec::decodeBinary(otherVersion).has_value());
+
+    EXPECT_FALSE(SaveCodec::decodeBinary({}).has_value());
+}
+
+TEST_F(SaveCodecTest, ConvertsBetweenFormats) {
+    const std::string text = SaveCodec::encodeJson(state);
+    const std::vector<char> data = SaveCodec::jsonToBinary(text);
+    ASSERT_FALSE(data.empty());
+
+    const auto fromJson = SaveCodec::decodeJson(SaveCodec::binaryToJson(data));
+    ASSERT_TRUE(fromJson.has_value());
+    expectEqual(state, *fromJson);
+
+    EXPECT_TRUE(SaveCodec::jsonToBinary("{ not json").empty());
+}
+
+TEST_F(SaveCodecTest, Crc32MatchesReference) {
+    const std::string check = "123456789";
+    EXPECT_EQ(SaveCodec::crc32(check.data(), check.size()), 0xCBF43926u);
+}
+
+TEST_F(SaveCodecTest, KeepsRegionAndPlayTime) {
+    state.region = "Beach";
+    state.playTime = 3725;
+    const auto decoded =
+        SaveCodec::decodeBinary(SaveCodec::encodeBinary(state));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->region, "Beach");
+    EXPECT_EQ(decoded->playTime, 3725u);
+    EXPECT_TRUE(decoded->thumbnail.empty()); // only kept in the slot index
+}
+
+TEST_F(SaveCodecTest, SlotIndexRoundTrip) {
+    std::map<std::string, SlotInfo> slots;
+    slots["1"] = { 1760000000, 4, "Underworld", 5400, {} };
+    slots["2"].thumbnail.assign(
+        SlotInfo::THUMBNAIL_WIDTH * SlotInfo::THUMBNAIL_HEIGHT * 3, 0x7F
+    );
+
+    std::vector<char> data = SaveCodec::encodeSlotIndex(slots);
+    const auto decoded = SaveCodec::decodeSlotIndex(data);
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), 2u);
+    EXPECT_EQ(decoded->at("1").savedAt, 1760000000);
+    EXPECT_EQ(decoded->at("1").level, 4);
+    EXPECT_EQ(decoded->at("1").region, "Underworld");
+    EXPECT_EQ(decoded->at("1").playTime, 5400u);
+    EXPECT_EQ(decoded->at("2").thumbnail, slots["2"].thumbnail);
+
+    // a save is not an index
+    EXPECT_FALSE(
+        SaveCodec::decodeSlotIndex(SaveCodec::encodeBinary(state)).has_value()
+    );
+    data.back() ^= 0x01;
+    EXPECT_FALSE(SaveCodec::decodeSlotIndex(data).has_value());
+}
+
+TEST_F(SaveCodecTest, SummaryText) {
+    const SlotInfo info = { 0, 3, "Beach", 3725, {} };
+    EXPECT_EQ(SaveGameManager::describeSlot(info), "Lv 3  Beach\nPlayed 1:02");
+}
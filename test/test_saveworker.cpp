@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "joanna/core/saveworker.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+
+#ifndef _WIN32
+class SaveWorkerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (const char* home = std::getenv("HOME")) {
+            oldHome = home;
+        }
+        dir = std::filesystem::temp_directory_path() / "joanna_saveworker";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        setenv("HOME", dir.c_str(), 1);
+    }
+
+    void TearDown() override {
+        setenv("HOME", oldHome.c_str(), 1);
+        std::filesystem::remove_all(dir);
+    }
+
+    std::filesystem::path dir;
+    std::string oldHome;
+};
+
+TEST_F(SaveWorkerTest, CoalescedSavesKeepEveryCallback) {
+    int calls = 0;
+    int succeeded = 0;
+    {
+        SaveWorker worker;
+        for (int i = 1; i <= 20; ++i) {
+            GameState state;
+            state.player.health = i;
+            worker.submit(state, "1", [&](bool success) {
+                ++calls;
+                succeeded += success ? 1 : 0;
+            });
+        }
+        worker.flush();
+        EXPECT_TRUE(worker.isIdle());
+    }
+    EXPECT_EQ(calls, 20);
+    EXPECT_EQ(succeeded, 20);
+
+    const SaveGameManager manager;
+    EXPECT_EQ(manager.loadGame("1").player.health, 20);
+
+    // the slot list comes from the index
+    const auto infos = manager.getSlotInfos({ "1", "2" });
+    ASSERT_TRUE(infos[0].has_value());
+    EXPECT_GT(infos[0]->savedAt, 0);
+    EXPECT_FALSE(infos[1].has_value());
+
+    // no temp file is left next to the slot
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(dir)) {
+        EXPECT_NE(entry.path().extension(), ".tmp");
+    }
+}
+
+TEST_F(SaveWorkerTest, DestructorWritesQueuedSaves) {
+    {
+        SaveWorker worker;
+        for (int slot = 1; slot <= 3; ++slot) {
+            GameState state;
+            state.player.level = slot;
+            worker.submit(state, std::to_string(slot));
+        }
+    }
+    const SaveGameManager manager;
+    for (int slot = 1; slot <= 3; ++slot) {
+        EXPECT_EQ(manager.loadGame(std::to_string(slot)).player.level, slot);
+    }
+}
+
+TEST_F(SaveWorkerTest, SlotListFollowsFilesOnDisk) {
+    {
+        SaveWorker worker;
+        GameState state;
+        state.player.level = 4;
+        worker.submit(state, "1");
+        worker.submit(state, "2");
+    }
+    const SaveGameManager manager;
+    ASSERT_TRUE(manager.getSlotInfos({ "1" })[0].has_value());
+
+    // removed outside the game some time later, the stale entry is dropped
+    const auto index = dir / ".local/share/Joanna/slots.idx";
+    std::filesystem::last_write_time(
+        index, std::filesystem::last_write_time(index) - std::chrono::hours(1)
+    );
+    std::filesystem::remove(dir / ".local/share/Joanna/savegame_1.sav");
+    const auto infos = manager.getSlotInfos({ "1", "2" });
+    EXPECT_FALSE(infos[0].has_value());
+    ASSERT_TRUE(infos[1].has_value());
+    EXPECT_EQ(infos[1]->level, 4);
+
+    // without an index the entries are rebuilt from the saves
+    std::filesystem::remove(index);
+    const auto rebuilt = manager.getSlotInfos({ "2" });
+    ASSERT_TRUE(rebuilt[0].has_value());
+    EXPECT_EQ(rebuilt[0]->level, 4);
+    EXPECT_TRUE(std::filesystem::exists(index));
+}
+
+TEST_F(SaveWorkerTest, ConvertedSlotKeepsItsSummary) {
+    const SaveGameManager manager;
+    GameState state;
+    state.player.level = 3;
+    state.region = "Beach";
+    state.thumbnail.assign(
+        SlotInfo::THUMBNAIL_WIDTH * SlotInfo::THUMBNAIL_HEIGHT * 3, 7
+    );
+    ASSERT_TRUE(manager.saveGame(state, "1", SaveFormat::Binary));
+    const std::int64_t savedAt = manager.getSlotInfos({ "1" })[0]->savedAt;
+
+    ASSERT_TRUE(manager.convertSlot("1", SaveFormat::Json));
+    EXPECT_EQ(manager.getSlotFormat("1"), SaveFormat::Json);
+    const auto info = manager.getSlotInfos({ "1" })[0];
+    ASSERT_TRUE(info.has_value());
+    EXPECT_EQ(info->level, 3);
+    EXPECT_EQ(info->region, "Beach");
+    EXPECT_EQ(info->thumbnail, state.thumbnail);
+    EXPECT_GE(info->savedAt, savedAt);
+}
+#endif
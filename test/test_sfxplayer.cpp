@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/musicplayer.h"
+#include "joanna/systems/sfxplayer.h"
+
+#include <vector>
+
+class SfxPlayerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+
+    void TearDown() override {
+    }
+};
+
+TEST_F(SfxPlayerTest, AttenuationFallsOffLinearly) {
+    EXPECT_FLOAT_EQ(SfxPlayer::attenuation(0.f), 1.f);
+    EXPECT_FLOAT_EQ(SfxPlayer::attenuation(SfxPlayer::MIN_DISTANCE), 1.f);
+
+    const float halfway =
+        (SfxPlayer::MIN_DISTANCE + SfxPlayer::MAX_DISTANCE) / 2.f;
+    EXPECT_FLOAT_EQ(SfxPlayer::attenuation(halfway), 0.5f);
+
+    EXPECT_FLOAT_EQ(SfxPlayer::attenuation(SfxPlayer::MAX_DISTANCE), 0.f);
+    EXPECT_FLOAT_EQ(SfxPlayer::attenuation(5000.f), 0.f);
+}
+
+TEST_F(SfxPlayerTest, EverySoundIsInTheManifest) {
+    const AudioManifest& manifest = AudioManifest::getInstance();
+    for (std::size_t i = 0; i < SfxPlayer::SFX_COUNT; ++i) {
+        const std::string_view name = SfxPlayer::getName(static_cast<SfxId>(i));
+        const SoundId id = manifest.find(name);
+        ASSERT_NE(id, NO_SOUND) << name;
+        EXPECT_NE(manifest.get(id).load, SoundLoad::Stream) << name;
+    }
+    for (std::size_t i = 0; i < MusicPlayer::MUSIC_COUNT; ++i) {
+        const std::string_view name =
+            MusicPlayer::getName(static_cast<MusicId>(i));
+        const SoundId id = manifest.find(name);
+        ASSERT_NE(id, NO_SOUND) << name;
+        EXPECT_EQ(manifest.get(id).load, SoundLoad::Stream) << name;
+    }
+}
+
+TEST_F(SfxPlayerTest, SameFrameTriggersPlayOnce) {
+    TriggerBatch batch;
+    EXPECT_TRUE(batch.add(3, 0.25f));
+    EXPECT_TRUE(batch.add(5, 1.f));
+    EXPECT_TRUE(batch.add(3, 0.75f));
+    EXPECT_TRUE(batch.add(3, 0.5f));
+
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.begin()->id, 3);
+    EXPECT_FLOAT_EQ(batch.begin()->gain, 0.75f); // the loudest one
+
+    batch.clear();
+    for (SoundId id = 0; id < TriggerBatch::CAPACITY; ++id) {
+        EXPECT_TRUE(batch.add(id, 1.f));
+    }
+    EXPECT_FALSE(batch.add(TriggerBatch::CAPACITY, 1.f));
+    EXPECT_TRUE(batch.add(0, 1.f)); // still merges
+    EXPECT_EQ(batch.size(), TriggerBatch::CAPACITY);
+}
+
+TEST_F(SfxPlayerTest, InstanceCapRestartsOldestCopy) {
+    VoicePool pool(SfxPlayer::VOICE_COUNT);
+    const std::size_t first = pool.allocate(1, 2, 0);
+    const std::size_t second = pool.allocate(1, 2, 0);
+    ASSERT_NE(first, VoicePool::NO_VOICE);
+    ASSERT_NE(second, first);
+
+    // a third copy replaces the first instead of taking a free voice
+    EXPECT_EQ(pool.allocate(1, 2, 0), first);
+    EXPECT_EQ(pool.getBusyCount(), 2u);
+    EXPECT_EQ(pool.allocate(1, 2, 0), second);
+
+    // other sounds are not limited by it
+    EXPECT_NE(pool.allocate(2, 2, 0), VoicePool::NO_VOICE);
+    EXPECT_EQ(pool.getBusyCount(), 3u);
+}
+
+TEST_F(SfxPlayerTest, FullPoolStealsLowestPriorityOldestVoice) {
+    VoicePool pool(SfxPlayer::VOICE_COUNT);
+    std::vector<std::size_t> started;
+    for (SoundId id = 0; id < SfxPlayer::VOICE_COUNT; ++id) {
+        // every other sound is important
+        started.push_back(pool.allocate(id, 4, id % 2 == 0 ? 0 : 5));
+    }
+    EXPECT_EQ(pool.getBusyCount(), SfxPlayer::VOICE_COUNT);
+
+    // the oldest low priority voice goes first, then the next one
+    EXPECT_EQ(pool.allocate(100, 4, 0), started[0]);
+    EXPECT_EQ(pool.allocate(101, 4, 0), started[2]);
+    EXPECT_EQ(pool.getSound(started[0]), 100);
+
+    EXPECT_EQ(pool.allocate(102, 4, 0), started[4]);
+
+    // a sound may not steal from a more important one
+    VoicePool important(2);
+    important.allocate(1, 4, 5);
+    important.allocate(2, 4, 5);
+    EXPECT_EQ(important.allocate(3, 4, 0), VoicePool::NO_VOICE);
+    EXPECT_NE(important.allocate(3, 4, 5), VoicePool::NO_VOICE);
+
+    // finished voices are reused before anything is stolen
+    pool.release(started[7]);
+    EXPECT_EQ(pool.allocate(300, 4, 0), started[7]);
+}
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include "joanna/core/spritebatch.h"
+
+namespace {
+const sf::FloatRect RECT({ 0.f, 0.f }, { 16.f, 16.f });
+const sf::IntRect TEX_RECT({ 0, 0 }, { 16, 16 });
+} // namespace
+
+TEST(SpriteBatchTest, MergesRunsOfTheSameTexture) {
+    const sf::Texture a;
+    const sf::Texture b;
+    SpriteBatch batch;
+    EXPECT_EQ(batch.getDrawCalls(), 0u);
+
+    for (int i = 0; i < 10; ++i) {
+        batch.add(a, RECT, TEX_RECT);
+    }
+    EXPECT_EQ(batch.getDrawCalls(), 1u);
+
+    sf::Sprite sprite(b);
+    batch.add(sprite);
+    batch.add(sprite);
+    EXPECT_EQ(batch.getDrawCalls(), 2u);
+
+    // draw order is kept, a goes on top of b again
+    batch.add(a, RECT, TEX_RECT);
+    EXPECT_EQ(batch.getDrawCalls(), 3u);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/textcache.h"
+#include "joanna/utils/resourcemanager.h"
+
+class TextCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Assuming assets are available in the build directory
+        font = &ResourceManager<sf::Font>::getInstance()->get(
+            "assets/font/minecraft.ttf"
+        );
+    }
+
+    void TearDown() override {
+    }
+
+    const sf::Font* font = nullptr;
+};
+
+TEST_F(TextCacheTest, SameKeyReturnsCachedLayout) {
+    TextStyle style;
+    style.size = 16;
+
+    TextCache& cache = TextCache::getInstance();
+    const TextLayout& a = cache.get(*font, "Hello", style);
+    const TextLayout& b = cache.get(*font, "Hello", style);
+    EXPECT_EQ(&a, &b);
+    EXPECT_EQ(a.fill.size(), 5u * 6u); // one quad per glyph
+    EXPECT_TRUE(a.outline.empty());
+
+    style.size = 18;
+    EXPECT_NE(&cache.get(*font, "Hello", style), &a);
+}
+
+TEST_F(TextCacheTest, WhitespaceHasNoGeometry) {
+    TextStyle style;
+    style.outlineThickness = 1.f;
+
+    const TextLayout& layout =
+        TextCache::getInstance().get(*font, "a b\nc", style);
+    EXPECT_EQ(layout.fill.size(), 3u * 6u);
+    EXPECT_EQ(layout.outline.size(), 3u * 6u);
+    EXPECT_GT(layout.bounds.size.y, static_cast<float>(style.size));
+}
+
+TEST_F(TextCacheTest, UnusedLayoutsAreEvicted) {
+    TextCache& cache = TextCache::getInstance();
+    TextStyle style;
+    cache.get(*font, "evict me", style);
+    const std::size_t before = cache.size();
+
+    for (int i = 0; i < 200; ++i) {
+        cache.endFrame();
+    }
+    EXPECT_LT(cache.size(), before);
+}
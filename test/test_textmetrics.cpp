@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "joanna/systems/textmetrics.h"
+#include "joanna/utils/resourcemanager.h"
+
+#include <algorithm>
+#include <sstream>
+
+class TextMetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Assuming assets are available in the build directory
+        font = &ResourceManager<sf::Font>::getInstance()->get(
+            "assets/font/minecraft.ttf"
+        );
+    }
+
+    void TearDown() override {
+    }
+
+    const sf::Font* font = nullptr;
+};
+
+TEST_F(TextMetricsTest, MeasureAddsAdvances) {
+    const TextMetrics& metrics = TextMetrics::get(*font, 16);
+    EXPECT_FLOAT_EQ(metrics.measure(""), 0.f);
+    EXPECT_FLOAT_EQ(
+        metrics.measure("ab"),
+        metrics.advance(U'a') + metrics.kerning(U'a', U'b') +
+            metrics.advance(U'b')
+    );
+    EXPECT_EQ(&TextMetrics::get(*font, 16), &metrics);
+}
+
+TEST_F(TextMetricsTest, WrappedLinesFitWidth) {
+    const TextMetrics& metrics = TextMetrics::get(*font, 16);
+    const std::string text =
+        "Welcome to the island, traveller. The pirates took the bridge "
+        "and the guards will not let anyone pass without a token.";
+    const float maxWidth = 200.f;
+
+    const std::string wrapped = metrics.wrap(text, maxWidth);
+    std::istringstream lines(wrapped);
+    std::string line;
+    int count = 0;
+    while (std::getline(lines, line)) {
+        EXPECT_LE(metrics.measure(line), maxWidth) << line;
+        ++count;
+    }
+    EXPECT_GT(count, 1);
+
+    // only spaces were turned into line breaks
+    std::string joined = wrapped;
+    std::replace(joined.begin(), joined.end(), '\n', ' ');
+    EXPECT_EQ(joined, text);
+}
+
+TEST_F(TextMetricsTest, KeepsNewlinesAndUtf8) {
+    const TextMetrics& metrics = TextMetrics::get(*font, 16);
+    EXPECT_EQ(metrics.wrap("Hallo\nWelt", 500.f), "Hallo\nWelt");
+    EXPECT_EQ(metrics.wrap("a   b", 500.f), "a b");
+    EXPECT_EQ(
+        metrics.wrap("Grüße aus Österreich", 500.f), "Grüße aus Österreich"
+    );
+}
+
+TEST_F(TextMetricsTest, LongWordStaysOnItsOwnLine) {
+    const TextMetrics& metrics = TextMetrics::get(*font, 16);
+    EXPECT_EQ(
+        metrics.wrap("a verylongwordthatdoesnotfit b", 40.f),
+        "a\nverylongwordthatdoesnotfit\nb"
+    );
+}
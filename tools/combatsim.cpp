@@ -0,0 +1,232 @@
+// Headless balance runs: resolves fights over a grid of player levels,
+// enemies and counter skills and prints one CSV row per grid cell.
+//
+//   combatsim [--fights N] [--levels FROM-TO] [--enemies NAME,...]
+//             [--skills 0,0.5,1] [--no-sword] [--shield] [--seed S]
+//             [--threads T] [--data assets/combat/attacks.json]
+
+#include "joanna/game/combat/combatsim.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// fights resolved by one job, jobs are seeded by index so the output does
+// not depend on the thread count
+constexpr std::uint64_t CHUNK = 1u << 16u;
+
+struct Options {
+    std::uint64_t fights = 100000; // per grid cell
+    int fromLevel = 1;
+    int toLevel = 10;
+    std::vector<std::string> enemies; // empty for all in the table
+    std::vector<float> skills = { 0.f, 0.5f, 1.f };
+    bool hasSword = true;
+    bool hasShield = false;
+    std::string data = AttackTable::DEFAULT_PATH;
+    std::uint64_t seed = 1;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+struct Job {
+    std::size_t cell;
+    std::uint64_t first; // index of the first fight in the cell
+    std::uint64_t count;
+};
+
+template <typename T> bool parseNumber(std::string_view text, T& out) {
+    const auto [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), out);
+    return error == std::errc() && end == text.data() + text.size();
+}
+
+std::vector<std::string> split(const std::string& text) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    for (std::string part; std::getline(stream, part, ',');) {
+        parts.push_back(part);
+    }
+    return parts;
+}
+
+bool parseArgs(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--no-sword") {
+            options.hasSword = false;
+            continue;
+        }
+        if (arg == "--shield") {
+            options.hasShield = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--fights") {
+            if (!parseNumber(value, options.fights)) {
+                return false;
+            }
+        } else if (arg == "--levels") {
+            const std::size_t dash = value.find('-');
+            const std::string_view text = value;
+            if (!parseNumber(text.substr(0, dash), options.fromLevel) ||
+                (dash != std::string::npos &&
+                 !parseNumber(text.substr(dash + 1), options.toLevel))) {
+                return false;
+            }
+            if (dash == std::string::npos) {
+                options.toLevel = options.fromLevel;
+            }
+        } else if (arg == "--enemies") {
+            options.enemies = split(value);
+        } else if (arg == "--skills") {
+            options.skills.clear();
+            for (const std::string& skill : split(value)) {
+                options.skills.push_back(std::strtof(skill.c_str(), nullptr));
+            }
+        } else if (arg == "--data") {
+            options.data = value;
+        } else if (arg == "--seed") {
+            if (!parseNumber(value, options.seed)) {
+                return false;
+            }
+        } else if (arg == "--threads") {
+            if (!parseNumber(value, options.threads) || options.threads == 0) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+    return options.fromLevel <= options.toLevel && !options.skills.empty();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        std::fprintf(
+            stderr,
+            "usage: %s [--fights N] [--levels FROM-TO] "
+            "[--enemies NAME,...] [--skills 0,0.5,1] [--no-sword] "
+            "[--shield] [--seed S] [--threads T] [--data FILE]\n",
+            argv[0]
+        );
+        return 1;
+    }
+
+    // before the workers start, they only read the table
+    AttackTable::setPath(options.data);
+    const AttackTable* table = nullptr;
+    try {
+        table = &AttackTable::getInstance();
+    } catch (const std::exception& e) {
+        std::fprintf(
+            stderr, "cannot load %s: %s\n", options.data.c_str(), e.what()
+        );
+        return 1;
+    }
+
+    if (options.enemies.empty()) {
+        for (const EnemyDefinition& enemy : table->getEnemies()) {
+            options.enemies.push_back(enemy.name);
+        }
+    }
+    for (const std::string& enemy : options.enemies) {
+        if (table->findEnemy(enemy) == nullptr) {
+            std::fprintf(
+                stderr, "no enemy %s in %s\n", enemy.c_str(),
+                options.data.c_str()
+            );
+            return 1;
+        }
+    }
+
+    std::vector<FightSetup> cells;
+    for (const std::string& enemy : options.enemies) {
+        for (int level = options.fromLevel; level <= options.toLevel;
+             ++level) {
+            for (const float skill : options.skills) {
+                cells.push_back(
+                    { level, enemy, options.hasSword, options.hasShield,
+                      skill > 0.f, skill }
+                );
+            }
+        }
+    }
+
+    std::vector<Job> jobs;
+    for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+        for (std::uint64_t first = 0; first < options.fights;
+             first += CHUNK) {
+            jobs.push_back(
+                { cell, first, std::min(CHUNK, options.fights - first) }
+            );
+        }
+    }
+
+    std::vector<FightStats> results(jobs.size());
+    std::atomic<std::size_t> next = 0;
+    const auto work = [&] {
+        for (std::size_t i = next++; i < jobs.size(); i = next++) {
+            const Job& job = jobs[i];
+            Pcg32 rng(options.seed, (job.cell << 32u) + (job.first / CHUNK));
+            results[i] = CombatSim::run(cells[job.cell], job.count, rng);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const unsigned threadCount =
+        std::min<unsigned>(options.threads, static_cast<unsigned>(jobs.size()));
+    for (unsigned i = 1; i < threadCount; ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // jobs of a cell are adjacent and merged in order
+    std::vector<FightStats> cellStats(cells.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        cellStats[jobs[i].cell].merge(results[i]);
+    }
+
+    std::printf(
+        "enemy,level,sword,shield,counter_skill,fights,win_rate,mean_turns,"
+        "p50_turns,p90_turns,mean_seconds,mean_damage_taken,"
+        "p10_damage_taken,p50_damage_taken,p90_damage_taken\n"
+    );
+    for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+        const FightSetup& setup = cells[cell];
+        const FightStats& stats = cellStats[cell];
+        std::printf(
+            "%s,%d,%d,%d,%.2f,%llu,%.4f,%.2f,%zu,%zu,%.2f,%.1f,%zu,%zu,%zu\n",
+            setup.enemy.c_str(),
+            setup.level, setup.hasSword ? 1 : 0, setup.hasShield ? 1 : 0,
+            setup.counterSkill,
+            static_cast<unsigned long long>(stats.fights), stats.winRate(),
+            FightStats::mean(stats.turns),
+            FightStats::percentile(stats.turns, 0.5),
+            FightStats::percentile(stats.turns, 0.9), stats.meanDuration(),
+            FightStats::mean(stats.damageTaken),
+            FightStats::percentile(stats.damageTaken, 0.1),
+            FightStats::percentile(stats.damageTaken, 0.5),
+            FightStats::percentile(stats.damageTaken, 0.9)
+        );
+    }
+    return 0;
+}